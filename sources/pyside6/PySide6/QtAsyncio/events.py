@@ -2,11 +2,13 @@
 # SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 from __future__ import annotations
 
-from PySide6.QtCore import (QCoreApplication, QDateTime, QDeadlineTimer,
-                            QEventLoop, QObject, QTimer, QThread, Slot)
+from PySide6.QtCore import (QCoreApplication, QDeadlineTimer,
+                            QEventLoop, QObject, QTimer, QThread,
+                            _QAsyncioScheduler)
 
 from . import futures
 from . import tasks
+from . import transports
 
 from typing import Any, Callable
 
@@ -15,11 +17,18 @@ import collections.abc
 import concurrent.futures
 import contextvars
 import enum
+import errno
 import os
 import signal
 import socket
 import subprocess
 import warnings
+import weakref
+
+try:
+    import ssl
+except ImportError:  # pragma: no cover
+    ssl = None  # type: ignore[assignment]
 
 __all__ = [
     "QAsyncioEventLoopPolicy", "QAsyncioEventLoop",
@@ -178,6 +187,15 @@ class QAsyncioEventLoop(asyncio.BaseEventLoop, QObject):
 
         self._closed = False
 
+        # The native ready queue and timer heap. All handles that are ready are
+        # run in one batch per iteration of the Qt event loop.
+        self._scheduler = _QAsyncioScheduler()
+
+        # The transports created by create_connection() and create_server(),
+        # by file descriptor. The file descriptors of the transports are
+        # watched with _add_reader() and _add_writer().
+        self._transports: weakref.WeakValueDictionary = weakref.WeakValueDictionary()
+
         # These two flags are used to determine whether the loop was stopped
         # from inside the loop (i.e., coroutine or callback called stop()) or
         # from outside the loop (i.e., the QApplication is being shut down, for
@@ -300,6 +318,7 @@ class QAsyncioEventLoop(asyncio.BaseEventLoop, QObject):
             return
         if self._default_executor is not None:
             self._default_executor.shutdown(wait=False)
+        self._scheduler.close()
         self._closed = True
 
     async def shutdown_asyncgens(self) -> None:
@@ -349,8 +368,7 @@ class QAsyncioEventLoop(asyncio.BaseEventLoop, QObject):
     def _call_soon_impl(self, callback: Callable, *args: Any,
                         context: contextvars.Context | None = None,
                         is_threadsafe: bool | None = False) -> asyncio.Handle:
-        return self._call_later_impl(0, callback, *args, context=context,
-                                     is_threadsafe=is_threadsafe)
+        return QAsyncioHandle(callback, args, self, context, is_threadsafe=is_threadsafe)
 
     def call_soon(self, callback: Callable, *args: Any,
                   context: contextvars.Context | None = None) -> asyncio.Handle:
@@ -389,7 +407,7 @@ class QAsyncioEventLoop(asyncio.BaseEventLoop, QObject):
         return self._call_at_impl(when, callback, *args, context=context, is_threadsafe=False)
 
     def time(self) -> float:
-        return QDateTime.currentMSecsSinceEpoch() / 1000
+        return self._scheduler.time()
 
     # Creating Futures and Tasks
 
@@ -418,15 +436,25 @@ class QAsyncioEventLoop(asyncio.BaseEventLoop, QObject):
 
     # Opening network connections
 
-    async def create_connection(
-            self, protocol_factory, host=None, port=None,
-            *, ssl=None, family=0, proto=0,
-            flags=0, sock=None, local_addr=None,
-            server_hostname=None,
-            ssl_handshake_timeout=None,
-            ssl_shutdown_timeout=None,
-            happy_eyeballs_delay=None, interleave=None):
-        raise NotImplementedError("QAsyncioEventLoop.create_connection() is not implemented yet")
+    # create_connection() of BaseEventLoop resolves the address and connects
+    # with sock_connect(), then creates a transport with
+    # _make_socket_transport().
+
+    def _make_socket_transport(self, sock, protocol, waiter=None, *,
+                               extra=None, server=None):
+        return transports.QAsyncioSocketTransport(self, sock, protocol, waiter, extra, server)
+
+    def _make_ssl_transport(self, rawsock, protocol, sslcontext, waiter=None,
+                            *, server_side=False, server_hostname=None,
+                            extra=None, server=None,
+                            ssl_handshake_timeout=None,
+                            ssl_shutdown_timeout=None):
+        # The TLS protocol of asyncio is stacked on a plain socket transport.
+        ssl_protocol = transports.create_ssl_protocol(
+            self, protocol, sslcontext, waiter, server_side, server_hostname,
+            ssl_handshake_timeout, ssl_shutdown_timeout)
+        transports.QAsyncioSocketTransport(self, rawsock, ssl_protocol, extra=extra, server=server)
+        return ssl_protocol._app_transport
 
     async def create_datagram_endpoint(self, protocol_factory,
                                        local_addr=None, remote_addr=None, *,
@@ -447,15 +475,79 @@ class QAsyncioEventLoop(asyncio.BaseEventLoop, QObject):
 
     # Creating network servers
 
-    async def create_server(
-            self, protocol_factory, host=None, port=None,
-            *, family=socket.AF_UNSPEC,
-            flags=socket.AI_PASSIVE, sock=None, backlog=100,
-            ssl=None, reuse_address=None, reuse_port=None,
-            ssl_handshake_timeout=None,
-            ssl_shutdown_timeout=None,
-            start_serving=True):
-        raise NotImplementedError("QAsyncioEventLoop.create_server() is not implemented yet")
+    # create_server() of BaseEventLoop binds the sockets and creates a Server,
+    # which calls _start_serving() and _stop_serving() for each socket.
+
+    def _start_serving(self, protocol_factory, sock, sslcontext=None, server=None,
+                       backlog=100, ssl_handshake_timeout=None,
+                       ssl_shutdown_timeout=None):
+        self._add_reader(sock.fileno(), self._accept_connection,
+                         protocol_factory, sock, sslcontext, server, backlog,
+                         ssl_handshake_timeout, ssl_shutdown_timeout)
+
+    def _stop_serving(self, sock):
+        self._remove_reader(sock.fileno())
+        sock.close()
+
+    def _accept_connection(self, protocol_factory, sock, sslcontext, server, backlog,
+                           ssl_handshake_timeout, ssl_shutdown_timeout) -> None:
+        """ Accept up to backlog pending connections when sock is readable. """
+        for _ in range(backlog):
+            try:
+                conn, address = sock.accept()
+                conn.setblocking(False)
+            except (BlockingIOError, InterruptedError, ConnectionAbortedError):
+                return
+            except OSError as e:
+                if e.errno not in (errno.EMFILE, errno.ENFILE, errno.ENOBUFS, errno.ENOMEM):
+                    raise
+                # Running out of resources, stop accepting for a while.
+                self.call_exception_handler({
+                    "message": "socket.accept() out of system resource",
+                    "exception": e,
+                    "socket": sock,
+                })
+                self._remove_reader(sock.fileno())
+                self.call_later(1.0, self._start_serving, protocol_factory, sock,
+                                sslcontext, server, backlog, ssl_handshake_timeout,
+                                ssl_shutdown_timeout)
+                return
+            self.create_task(self._accept_connection2(
+                protocol_factory, conn, {"peername": address}, sslcontext, server,
+                ssl_handshake_timeout, ssl_shutdown_timeout))
+
+    async def _accept_connection2(self, protocol_factory, conn, extra, sslcontext, server,
+                                  ssl_handshake_timeout, ssl_shutdown_timeout) -> None:
+        """ Create the protocol and the transport of an accepted connection. """
+        protocol = None
+        transport = None
+        try:
+            protocol = protocol_factory()
+            waiter = self.create_future()
+            if sslcontext:
+                transport = self._make_ssl_transport(
+                    conn, protocol, sslcontext, waiter, server_side=True, extra=extra,
+                    server=server, ssl_handshake_timeout=ssl_handshake_timeout,
+                    ssl_shutdown_timeout=ssl_shutdown_timeout)
+            else:
+                transport = self._make_socket_transport(conn, protocol, waiter,
+                                                        extra=extra, server=server)
+            try:
+                await waiter
+            except BaseException:
+                transport.close()
+                raise
+        except (SystemExit, KeyboardInterrupt):
+            raise
+        except BaseException as e:
+            if transport is None:
+                conn.close()
+            self.call_exception_handler({
+                "message": "Error on transport creation for incoming connection",
+                "exception": e,
+                "protocol": protocol,
+                "transport": transport,
+            })
 
     async def create_unix_server(
             self, protocol_factory, path=None, *,
@@ -490,43 +582,170 @@ class QAsyncioEventLoop(asyncio.BaseEventLoop, QObject):
 
     # Watching file descriptors
 
+    # The scheduler keeps one socket notifier per file descriptor and
+    # direction. The handle is run each time the file descriptor is ready,
+    # the notifier is disarmed while the callback runs.
+
+    def _add_reader(self, fd, callback: Callable, *args: Any) -> asyncio.Handle:
+        self._check_closed()
+        handle = QAsyncioFdHandle(callback, args, self, None)
+        previous = self._scheduler.add_reader(fd, handle)
+        if previous is not None:
+            previous.cancel()
+        return handle
+
+    def _remove_reader(self, fd) -> bool:
+        if self.is_closed():
+            return False
+        handle = self._scheduler.remove_reader(fd)
+        if handle is None:
+            return False
+        handle.cancel()
+        return True
+
+    def _add_writer(self, fd, callback: Callable, *args: Any) -> asyncio.Handle:
+        self._check_closed()
+        handle = QAsyncioFdHandle(callback, args, self, None)
+        previous = self._scheduler.add_writer(fd, handle)
+        if previous is not None:
+            previous.cancel()
+        return handle
+
+    def _remove_writer(self, fd) -> bool:
+        if self.is_closed():
+            return False
+        handle = self._scheduler.remove_writer(fd)
+        if handle is None:
+            return False
+        handle.cancel()
+        return True
+
+    def _ensure_fd_no_transport(self, fd) -> None:
+        """ Reject watching a file descriptor that belongs to a transport. """
+        if not isinstance(fd, int):
+            try:
+                fd = int(fd.fileno())
+            except (AttributeError, TypeError, ValueError):
+                raise ValueError(f"Invalid file object: {fd!r}") from None
+        transport = self._transports.get(fd)
+        if transport is not None and not transport.is_closing():
+            raise RuntimeError(f"File descriptor {fd!r} is used by transport {transport!r}")
+
     def add_reader(self, fd, callback, *args):
-        raise NotImplementedError("QAsyncioEventLoop.add_reader() is not implemented yet")
+        self._ensure_fd_no_transport(fd)
+        self._add_reader(fd, callback, *args)
 
     def remove_reader(self, fd):
-        raise NotImplementedError("QAsyncioEventLoop.remove_reader() is not implemented yet")
+        self._ensure_fd_no_transport(fd)
+        return self._remove_reader(fd)
 
     def add_writer(self, fd, callback, *args):
-        raise NotImplementedError("QAsyncioEventLoop.add_writer() is not implemented yet")
+        self._ensure_fd_no_transport(fd)
+        self._add_writer(fd, callback, *args)
 
     def remove_writer(self, fd):
-        raise NotImplementedError("QAsyncioEventLoop.remove_writer() is not implemented yet")
+        self._ensure_fd_no_transport(fd)
+        return self._remove_writer(fd)
 
     # Working with socket objects directly
 
+    def _check_sock(self, sock: socket.socket) -> None:
+        if ssl is not None and isinstance(sock, ssl.SSLSocket):
+            raise TypeError("Socket cannot be of type SSLSocket")
+        if self._debug and sock.gettimeout() != 0:
+            raise ValueError("the socket must be non-blocking")
+
+    async def _sock_wait(self, sock: socket.socket, write: bool) -> None:
+        """ Wait until the socket is readable or writable. """
+        fd = sock.fileno()
+        self._ensure_fd_no_transport(fd)
+        future = self.create_future()
+
+        def ready() -> None:
+            if not future.done():
+                future.set_result(None)
+
+        if write:
+            self._add_writer(fd, ready)
+        else:
+            self._add_reader(fd, ready)
+        try:
+            await future
+        finally:
+            if write:
+                self._remove_writer(fd)
+            else:
+                self._remove_reader(fd)
+
+    async def _sock_io(self, sock: socket.socket, write: bool,
+                       function: Callable, *args: Any) -> Any:
+        """
+        Call a non-blocking socket function, waiting for the socket to become
+        ready as long as it would block.
+        """
+        self._check_sock(sock)
+        while True:
+            try:
+                return function(*args)
+            except (BlockingIOError, InterruptedError):
+                pass
+            await self._sock_wait(sock, write)
+
     async def sock_recv(self, sock, nbytes):
-        raise NotImplementedError("QAsyncioEventLoop.sock_recv() is not implemented yet")
+        return await self._sock_io(sock, False, sock.recv, nbytes)
 
     async def sock_recv_into(self, sock, buf):
-        raise NotImplementedError("QAsyncioEventLoop.sock_recv_into() is not implemented yet")
+        return await self._sock_io(sock, False, sock.recv_into, buf)
 
     async def sock_recvfrom(self, sock, bufsize):
-        raise NotImplementedError("QAsyncioEventLoop.sock_recvfrom() is not implemented yet")
+        return await self._sock_io(sock, False, sock.recvfrom, bufsize)
 
     async def sock_recvfrom_into(self, sock, buf, nbytes=0):
-        raise NotImplementedError("QAsyncioEventLoop.sock_recvfrom_into() is not implemented yet")
+        if not nbytes:
+            nbytes = len(buf)
+        return await self._sock_io(sock, False, sock.recvfrom_into, buf, nbytes)
 
     async def sock_sendall(self, sock, data):
-        raise NotImplementedError("QAsyncioEventLoop.sock_sendall() is not implemented yet")
+        self._check_sock(sock)
+        view = memoryview(data)
+        while view:
+            try:
+                view = view[sock.send(view):]
+                continue
+            except (BlockingIOError, InterruptedError):
+                pass
+            await self._sock_wait(sock, True)
 
     async def sock_sendto(self, sock, data, address):
-        raise NotImplementedError("QAsyncioEventLoop.sock_sendto() is not implemented yet")
+        return await self._sock_io(sock, True, sock.sendto, data, address)
 
     async def sock_connect(self, sock, address):
-        raise NotImplementedError("QAsyncioEventLoop.sock_connect() is not implemented yet")
+        self._check_sock(sock)
+        if sock.family == socket.AF_INET or sock.family == getattr(socket, "AF_INET6", None):
+            host = address[0]
+            try:
+                socket.inet_pton(sock.family, host)
+            except (OSError, TypeError):
+                # Not a numeric address, resolve it without blocking the loop.
+                resolved = await self.getaddrinfo(host, address[1], family=sock.family,
+                                                  type=sock.type, proto=sock.proto)
+                if not resolved:
+                    raise OSError(f"getaddrinfo({host!r}) returned an empty list")
+                _, _, _, _, address = resolved[0]
+        try:
+            sock.connect(address)
+            return
+        except (BlockingIOError, InterruptedError):
+            pass
+        await self._sock_wait(sock, True)
+        error = sock.getsockopt(socket.SOL_SOCKET, socket.SO_ERROR)
+        if error != 0:
+            raise OSError(error, f"Connect call failed {address}")
 
     async def sock_accept(self, sock):
-        raise NotImplementedError("QAsyncioEventLoop.sock_accept() is not implemented yet")
+        conn, address = await self._sock_io(sock, False, sock.accept)
+        conn.setblocking(False)
+        return conn, address
 
     async def sock_sendfile(self, sock, file, offset=0, count=None, *,
                             fallback=None):
@@ -536,10 +755,11 @@ class QAsyncioEventLoop(asyncio.BaseEventLoop, QObject):
 
     async def getaddrinfo(self, host, port, *,
                           family=0, type=0, proto=0, flags=0):
-        raise NotImplementedError("QAsyncioEventLoop.getaddrinfo() is not implemented yet")
+        return await self.run_in_executor(None, socket.getaddrinfo,
+                                          host, port, family, type, proto, flags)
 
     async def getnameinfo(self, sockaddr, flags=0):
-        raise NotImplementedError("QAsyncioEventLoop.getnameinfo() is not implemented yet")
+        return await self.run_in_executor(None, socket.getnameinfo, sockaddr, flags)
 
     # Working with pipes
 
@@ -652,34 +872,29 @@ class QAsyncioHandle():
         self._context = context
         self._is_threadsafe = is_threadsafe
 
-        self._timeout = 0
-
         self._state = QAsyncioHandle.HandleState.PENDING
         self._start()
 
     def _start(self) -> None:
-        self._schedule_event(self._timeout, lambda: self._cb())
-
-    def _schedule_event(self, timeout: int, func: Callable) -> None:
         # Do not schedule events from asyncio when the app is quit from outside
         # the event loop, as this would cause events to be enqueued after the
         # event loop was destroyed.
         if not self._loop.is_closed() and not self._loop._quit_from_outside:
-            if self._is_threadsafe:
-                # This singleShot overload will push func into self._loop
-                # instead of the current thread's loop. This allows scheduling
-                # a callback from a different thread, which is necessary for
-                # thread-safety.
-                # https://docs.python.org/3/library/asyncio-dev.html#asyncio-multithreading
-                QTimer.singleShot(timeout, self._loop, func)
-            else:
-                QTimer.singleShot(timeout, func)
+            self._schedule(self._loop._scheduler)
+
+    def _schedule(self, scheduler: _QAsyncioScheduler) -> None:
+        if self._is_threadsafe:
+            # This wakes up the event loop if it is in a different thread,
+            # which is necessary for thread-safety.
+            # https://docs.python.org/3/library/asyncio-dev.html#asyncio-multithreading
+            scheduler.call_soon_threadsafe(self)
+        else:
+            scheduler.call_soon(self)
 
-    @Slot()
     def _cb(self) -> None:
         """
-        A slot, enqueued into the event loop, that wraps around the actual
-        callback, typically the step function of a task.
+        Called by the scheduler of the event loop to run the actual callback,
+        typically the step function of a task.
         """
         if self._state == QAsyncioHandle.HandleState.PENDING:
             if self._context is not None:
@@ -690,37 +905,43 @@ class QAsyncioHandle():
 
     def cancel(self) -> None:
         if self._state == QAsyncioHandle.HandleState.PENDING:
-            # The old timer that was created in _start will still trigger but
-            # _cb won't do anything, therefore the callback is effectively
-            # cancelled.
+            # The scheduler will still run the handle that was enqueued in
+            # _start but _cb won't do anything, therefore the callback is
+            # effectively cancelled.
             self._state = QAsyncioHandle.HandleState.CANCELLED
 
     def cancelled(self) -> bool:
         return self._state == QAsyncioHandle.HandleState.CANCELLED
 
 
+class QAsyncioFdHandle(QAsyncioHandle):
+    """
+    The handle of add_reader() and add_writer(). It is not enqueued, but run
+    by the scheduler each time the file descriptor is ready until it is
+    removed or cancelled.
+    """
+    def _start(self) -> None:
+        pass
+
+    def _cb(self) -> None:
+        if self._state == QAsyncioHandle.HandleState.PENDING:
+            if self._context is not None:
+                self._context.run(self._callback, *self._args)
+            else:
+                self._callback(*self._args)
+
+
 class QAsyncioTimerHandle(QAsyncioHandle, asyncio.TimerHandle):
     def __init__(self, when: float, callback: Callable, args: tuple,
                  loop: QAsyncioEventLoop, context: contextvars.Context | None,
                  is_threadsafe: bool | None = False) -> None:
-        QAsyncioHandle.__init__(self, callback, args, loop, context, is_threadsafe)
-
         self._when = when
-        time = self._loop.time()
-
-        # PYSIDE-2644: Timeouts should be rounded up or down instead of only up
-        # as happens with int(). Otherwise, a timeout of e.g. 0.9 would be
-        # handled as 0, where 1 would be more appropriate.
-        self._timeout = round(max(self._when - time, 0) * 1000)
-
-        QAsyncioHandle._start(self)
+        QAsyncioHandle.__init__(self, callback, args, loop, context, is_threadsafe)
 
-    def _start(self) -> None:
-        """
-        Overridden so that timer.start() is only called once at the end of the
-        constructor for both QtHandle and QtTimerHandle.
-        """
-        pass
+    def _schedule(self, scheduler: _QAsyncioScheduler) -> None:
+        # The scheduler runs the handle once the monotonic clock of time()
+        # reaches when(), so there is no rounding of the timeout.
+        scheduler.call_at(self._when, self)
 
     def when(self) -> float:
         return self._when
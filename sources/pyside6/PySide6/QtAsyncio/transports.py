@@ -0,0 +1,384 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+from __future__ import annotations
+
+from typing import Any
+
+import asyncio
+import collections
+import socket
+import sys
+import warnings
+
+__all__ = [
+    "QAsyncioSocketTransport", "create_ssl_protocol",
+]
+
+
+# asyncio.Server counts the transports serving its connections to implement
+# wait_closed(). Since Python 3.13, the transport is passed as well.
+if sys.version_info >= (3, 13):
+    def _server_attach(server, transport) -> None:
+        server._attach(transport)
+
+    def _server_detach(server, transport) -> None:
+        server._detach(transport)
+else:
+    def _server_attach(server, transport) -> None:
+        server._attach()
+
+    def _server_detach(server, transport) -> None:
+        server._detach()
+
+
+def create_ssl_protocol(loop: asyncio.AbstractEventLoop, protocol: asyncio.BaseProtocol,
+                        sslcontext, waiter: asyncio.Future | None, server_side: bool,
+                        server_hostname: str | None, ssl_handshake_timeout: float | None,
+                        ssl_shutdown_timeout: float | None) -> asyncio.BaseProtocol:
+    """
+    Create the TLS protocol of asyncio, which is stacked on a socket
+    transport. Its application transport is returned as _app_transport.
+    asyncio does not provide a public API for this; the keyword argument
+    ssl_shutdown_timeout exists since Python 3.11.
+    """
+    try:
+        from asyncio.sslproto import SSLProtocol
+    except ImportError:  # pragma: no cover
+        raise NotImplementedError("TLS is not supported by QtAsyncio with this version of Python")
+    kwargs: dict[str, Any] = {"ssl_handshake_timeout": ssl_handshake_timeout}
+    if sys.version_info >= (3, 11):
+        kwargs["ssl_shutdown_timeout"] = ssl_shutdown_timeout
+    elif ssl_shutdown_timeout is not None:
+        raise ValueError("ssl_shutdown_timeout requires Python 3.11")
+    ssl_protocol = SSLProtocol(loop, protocol, sslcontext, waiter, server_side,
+                               server_hostname, **kwargs)
+    if getattr(ssl_protocol, "_app_transport", None) is None:  # pragma: no cover
+        raise NotImplementedError("TLS is not supported by QtAsyncio with this version of Python")
+    return ssl_protocol
+
+
+class QAsyncioSocketTransport(asyncio.Transport):
+    """
+    A stream transport on a connected non-blocking socket. The socket is
+    watched by the socket notifiers of the event loop, which are registered
+    with _add_reader() and _add_writer(). Both protocols receiving data with
+    data_received() and buffered protocols are supported.
+    """
+
+    max_size = 256 * 1024  # Buffer size passed to recv()
+    _sock: socket.socket | None = None
+
+    def __init__(self, loop: asyncio.AbstractEventLoop, sock: socket.socket,
+                 protocol: asyncio.BaseProtocol, waiter: asyncio.Future | None = None,
+                 extra: dict[str, Any] | None = None, server=None) -> None:
+        super().__init__(extra)
+        self._extra["socket"] = sock
+        try:
+            self._extra["sockname"] = sock.getsockname()
+        except OSError:
+            self._extra["sockname"] = None
+        if "peername" not in self._extra:
+            try:
+                self._extra["peername"] = sock.getpeername()
+            except OSError:
+                self._extra["peername"] = None
+
+        self._loop = loop
+        self._sock = sock
+        self._sock_fd = sock.fileno()
+        self._protocol: asyncio.BaseProtocol
+        self._protocol_buffered = False
+        self.set_protocol(protocol)
+        self._server = server
+
+        self._buffer: collections.deque = collections.deque()
+        self._buffer_size = 0
+        self._conn_lost = 0  # Set when the connection is lost or closed
+        self._closing = False
+        self._eof = False  # Set when write_eof() is called
+        self._paused = False  # Set when reading is paused
+
+        self._protocol_paused = False  # Set when writing is paused
+        self._high_water = 64 * 1024
+        self._low_water = 16 * 1024
+
+        # The loop rejects add_reader() and add_writer() for this socket while
+        # the transport exists.
+        self._loop._transports[self._sock_fd] = self
+        if self._server is not None:
+            _server_attach(self._server, self)
+
+        if self._sock.type == socket.SOCK_STREAM:
+            try:
+                self._sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+            except (AttributeError, OSError):
+                pass
+
+        self._loop.call_soon(self._protocol.connection_made, self)
+        self._loop.call_soon(self._add_reader)
+        if waiter is not None:
+            self._loop.call_soon(self._set_waiter_result, waiter)
+
+    def __repr__(self) -> str:
+        state = "closed" if self._sock is None else "closing" if self._closing else "open"
+        return f"<{self.__class__.__name__} fd={self._sock_fd} {state}>"
+
+    def __del__(self, _warn=warnings.warn) -> None:
+        if self._sock is not None:
+            _warn(f"unclosed transport {self!r}", ResourceWarning, source=self)
+            self._sock.close()
+
+    @staticmethod
+    def _set_waiter_result(waiter: asyncio.Future) -> None:
+        if not waiter.cancelled():
+            waiter.set_result(None)
+
+    # BaseTransport
+
+    def is_closing(self) -> bool:
+        return self._closing
+
+    def close(self) -> None:
+        if self._closing:
+            return
+        self._closing = True
+        self._loop._remove_reader(self._sock_fd)
+        if not self._buffer:
+            self._conn_lost += 1
+            self._loop._remove_writer(self._sock_fd)
+            self._loop.call_soon(self._call_connection_lost, None)
+
+    def set_protocol(self, protocol: asyncio.BaseProtocol) -> None:
+        self._protocol = protocol
+        self._protocol_buffered = isinstance(protocol, asyncio.BufferedProtocol)
+
+    def get_protocol(self) -> asyncio.BaseProtocol:
+        return self._protocol
+
+    # ReadTransport
+
+    def is_reading(self) -> bool:
+        return not self._paused and not self._closing
+
+    def pause_reading(self) -> None:
+        if not self.is_reading():
+            return
+        self._paused = True
+        self._loop._remove_reader(self._sock_fd)
+
+    def resume_reading(self) -> None:
+        if self._closing or not self._paused:
+            return
+        self._paused = False
+        self._add_reader()
+
+    def _add_reader(self) -> None:
+        if self.is_reading():
+            self._loop._add_reader(self._sock_fd, self._read_ready)
+
+    def _read_ready(self) -> None:
+        if self._conn_lost:
+            return
+        try:
+            if self._protocol_buffered:
+                buffer = self._protocol.get_buffer(-1)
+                if not len(buffer):
+                    raise RuntimeError("get_buffer() returned an empty buffer")
+                size = self._sock.recv_into(buffer)
+                data = None
+            else:
+                data = self._sock.recv(self.max_size)
+                size = len(data)
+        except (BlockingIOError, InterruptedError):
+            return
+        except (SystemExit, KeyboardInterrupt):
+            raise
+        except BaseException as e:
+            self._fatal_error(e, "Fatal read error on socket transport")
+            return
+
+        try:
+            if not size:
+                self._read_eof()
+            elif self._protocol_buffered:
+                self._protocol.buffer_updated(size)
+            else:
+                self._protocol.data_received(data)
+        except (SystemExit, KeyboardInterrupt):
+            raise
+        except BaseException as e:
+            self._fatal_error(e, "Fatal error: protocol failed to process the received data")
+
+    def _read_eof(self) -> None:
+        keep_open = self._protocol.eof_received()
+        if keep_open:
+            # The protocol wants to keep writing, stop reading from the socket.
+            self._loop._remove_reader(self._sock_fd)
+        else:
+            self.close()
+
+    # WriteTransport
+
+    def get_write_buffer_size(self) -> int:
+        return self._buffer_size
+
+    def get_write_buffer_limits(self) -> tuple[int, int]:
+        return (self._low_water, self._high_water)
+
+    def set_write_buffer_limits(self, high: int | None = None, low: int | None = None) -> None:
+        if high is None:
+            high = 64 * 1024 if low is None else 4 * low
+        if low is None:
+            low = high // 4
+        if not high >= low >= 0:
+            raise ValueError(f"high ({high!r}) must be >= low ({low!r}) must be >= 0")
+        self._high_water = high
+        self._low_water = low
+        self._maybe_pause_protocol()
+
+    def write(self, data) -> None:
+        if not isinstance(data, (bytes, bytearray, memoryview)):
+            raise TypeError(f"data argument must be a bytes-like object, "
+                            f"not {type(data).__name__!r}")
+        if self._eof:
+            raise RuntimeError("Cannot call write() after write_eof()")
+        if not data:
+            return
+        if self._conn_lost:
+            self._conn_lost += 1
+            return
+
+        if not self._buffer:
+            try:
+                sent = self._sock.send(data)
+            except (BlockingIOError, InterruptedError):
+                sent = 0
+            except (SystemExit, KeyboardInterrupt):
+                raise
+            except BaseException as e:
+                self._fatal_error(e, "Fatal write error on socket transport")
+                return
+            if sent == len(data):
+                return
+            data = memoryview(data)[sent:]
+            self._loop._add_writer(self._sock_fd, self._write_ready)
+
+        # Keep a copy, the caller may modify a mutable buffer after write().
+        data = bytes(data)
+        self._buffer.append(data)
+        self._buffer_size += len(data)
+        self._maybe_pause_protocol()
+
+    def _write_ready(self) -> None:
+        if self._conn_lost:
+            return
+        while self._buffer:
+            data = self._buffer[0]
+            try:
+                sent = self._sock.send(data)
+            except (BlockingIOError, InterruptedError):
+                return
+            except (SystemExit, KeyboardInterrupt):
+                raise
+            except BaseException as e:
+                self._loop._remove_writer(self._sock_fd)
+                self._buffer.clear()
+                self._buffer_size = 0
+                self._fatal_error(e, "Fatal write error on socket transport")
+                return
+            self._buffer_size -= sent
+            if sent < len(data):
+                self._buffer[0] = memoryview(data)[sent:]
+                break
+            self._buffer.popleft()
+
+        self._maybe_resume_protocol()
+        if not self._buffer:
+            self._loop._remove_writer(self._sock_fd)
+            if self._closing:
+                self._call_connection_lost(None)
+            elif self._eof:
+                self._sock.shutdown(socket.SHUT_WR)
+
+    def write_eof(self) -> None:
+        if self._closing or self._eof:
+            return
+        self._eof = True
+        if not self._buffer:
+            self._sock.shutdown(socket.SHUT_WR)
+
+    def can_write_eof(self) -> bool:
+        return True
+
+    def abort(self) -> None:
+        self._force_close(None)
+
+    def _maybe_pause_protocol(self) -> None:
+        if self._buffer_size <= self._high_water or self._protocol_paused:
+            return
+        self._protocol_paused = True
+        try:
+            self._protocol.pause_writing()
+        except (SystemExit, KeyboardInterrupt):
+            raise
+        except BaseException as e:
+            self._loop.call_exception_handler({
+                "message": "protocol.pause_writing() failed",
+                "exception": e,
+                "transport": self,
+                "protocol": self._protocol,
+            })
+
+    def _maybe_resume_protocol(self) -> None:
+        if not self._protocol_paused or self._buffer_size > self._low_water:
+            return
+        self._protocol_paused = False
+        try:
+            self._protocol.resume_writing()
+        except (SystemExit, KeyboardInterrupt):
+            raise
+        except BaseException as e:
+            self._loop.call_exception_handler({
+                "message": "protocol.resume_writing() failed",
+                "exception": e,
+                "transport": self,
+                "protocol": self._protocol,
+            })
+
+    # Closing
+
+    def _fatal_error(self, exc: BaseException, message: str) -> None:
+        # Connection errors are reported to the protocol only.
+        if not isinstance(exc, OSError):
+            self._loop.call_exception_handler({
+                "message": message,
+                "exception": exc,
+                "transport": self,
+                "protocol": self._protocol,
+            })
+        self._force_close(exc)
+
+    def _force_close(self, exc: BaseException | None) -> None:
+        if self._conn_lost:
+            return
+        if self._buffer:
+            self._buffer.clear()
+            self._buffer_size = 0
+            self._loop._remove_writer(self._sock_fd)
+        if not self._closing:
+            self._closing = True
+            self._loop._remove_reader(self._sock_fd)
+        self._conn_lost += 1
+        self._loop.call_soon(self._call_connection_lost, exc)
+
+    def _call_connection_lost(self, exc: BaseException | None) -> None:
+        if self._sock is None:
+            return
+        try:
+            self._protocol.connection_lost(exc)
+        finally:
+            self._sock.close()
+            self._sock = None
+            if self._server is not None:
+                _server_detach(self._server, self)
+                self._server = None
@@ -282,7 +282,7 @@ PyObject *invokeMetaMethod(const InvokeMetaMethodFunc &f,
                            a3.toGenericArgument(), a4.toGenericArgument(), a5.toGenericArgument(),
                            a6.toGenericArgument(), a7.toGenericArgument(), a8.toGenericArgument(),
                            a9.toGenericArgument());
-    PyEval_RestoreThread(_save); // Py_END_ALLOW_THREADS
+    Shiboken::GilState::restoreThread(_save); // Py_END_ALLOW_THREADS
     PyObject *result = resultB ? Py_True : Py_False;
     Py_INCREF(result);
     return result;
@@ -339,7 +339,7 @@ PyObject *invokeMetaMethodWithReturn(const InvokeMetaMethodFuncWithReturn &f,
                               a3.toGenericArgument(), a4.toGenericArgument(), a5.toGenericArgument(),
                               a6.toGenericArgument(), a7.toGenericArgument(), a8.toGenericArgument(),
                               a9.toGenericArgument());
-    PyEval_RestoreThread(_save); // Py_END_ALLOW_THREADS
+    Shiboken::GilState::restoreThread(_save); // Py_END_ALLOW_THREADS
     if (!callResult)
         return PyErr_Format(PyExc_RuntimeError, "QMetaMethod invocation failed.");
     return convertGenericReturnArgument(r.data(), r.metaType());
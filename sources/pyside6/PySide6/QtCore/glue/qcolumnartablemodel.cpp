@@ -0,0 +1,166 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qcolumnartablemodel.h"
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtCoreHelper
+{
+
+QColumnarTableModel::QColumnarTableModel(QObject *parent) : QAbstractTableModel(parent)
+{
+}
+
+QColumnarTableModel::~QColumnarTableModel() = default;
+
+int QColumnarTableModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_rowCount;
+}
+
+int QColumnarTableModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : int(m_columns.size());
+}
+
+const QVariant &QColumnarTableModel::value(int row, int column, int role) const
+{
+    static const QVariant invalid;
+    if (column < 0 || column >= m_columns.size())
+        return invalid;
+    const RoleColumns &roleColumns = m_columns.at(column);
+    auto it = roleColumns.constFind(storageRole(role));
+    if (it == roleColumns.cend() || row < 0 || row >= it.value().size())
+        return invalid;
+    return it.value().at(row);
+}
+
+QVariant QColumnarTableModel::data(const QModelIndex &index, int role) const
+{
+    return index.isValid() ? value(index.row(), index.column(), role) : QVariant{};
+}
+
+void QColumnarTableModel::multiData(const QModelIndex &index,
+                                    QModelRoleDataSpan roleDataSpan) const
+{
+    if (!index.isValid())
+        return;
+    for (QModelRoleData &roleData : roleDataSpan)
+        roleData.setData(value(index.row(), index.column(), roleData.role()));
+}
+
+bool QColumnarTableModel::setData(const QModelIndex &index, const QVariant &value, int role)
+{
+    if (!checkIndex(index, CheckIndexOption::IndexIsValid))
+        return false;
+    QVariantList &values = m_columns[index.column()][storageRole(role)];
+    if (values.size() <= index.row())
+        values.resize(m_rowCount);
+    values[index.row()] = value;
+    QList<int> roles{role};
+    if (storageRole(role) == Qt::DisplayRole)
+        roles = {Qt::DisplayRole, Qt::EditRole};
+    Q_EMIT dataChanged(index, index, roles);
+    return true;
+}
+
+QVariant QColumnarTableModel::headerData(int section, Qt::Orientation orientation,
+                                         int role) const
+{
+    const auto &headers = orientation == Qt::Horizontal
+        ? m_horizontalHeaders : m_verticalHeaders;
+    auto it = headers.constFind(section);
+    if (it != headers.cend()) {
+        auto valueIt = it.value().constFind(storageRole(role));
+        if (valueIt != it.value().cend())
+            return valueIt.value();
+    }
+    return QAbstractTableModel::headerData(section, orientation, role);
+}
+
+bool QColumnarTableModel::setHeaderData(int section, Qt::Orientation orientation,
+                                        const QVariant &value, int role)
+{
+    const int count = orientation == Qt::Horizontal ? columnCount() : rowCount();
+    if (section < 0 || section >= count)
+        return false;
+    auto &headers = orientation == Qt::Horizontal ? m_horizontalHeaders : m_verticalHeaders;
+    headers[section].insert(storageRole(role), value);
+    Q_EMIT headerDataChanged(orientation, section, section);
+    return true;
+}
+
+// Calculate the row count from the longest column, optionally ignoring
+// the values of one role of a column which are about to be replaced.
+int QColumnarTableModel::calculateRowCount(int skipColumn, int skipRole) const
+{
+    qsizetype result = 0;
+    for (qsizetype c = 0, size = m_columns.size(); c < size; ++c) {
+        const RoleColumns &roleColumns = m_columns.at(c);
+        for (auto it = roleColumns.cbegin(), end = roleColumns.cend(); it != end; ++it) {
+            if (c != skipColumn || it.key() != skipRole)
+                result = std::max(result, it.value().size());
+        }
+    }
+    return int(result);
+}
+
+void QColumnarTableModel::setColumnCount(int columns)
+{
+    if (columns < 0 || columns == m_columns.size())
+        return;
+    beginResetModel();
+    m_columns.resize(columns);
+    m_rowCount = calculateRowCount();
+    endResetModel();
+}
+
+void QColumnarTableModel::setColumnData(int column, const QVariantList &values, int role)
+{
+    if (column < 0)
+        return;
+    role = storageRole(role);
+    const bool newColumn = column >= m_columns.size();
+    const int newRowCount = std::max(calculateRowCount(column, role), int(values.size()));
+
+    if (newColumn || newRowCount != m_rowCount) {
+        beginResetModel();
+        if (newColumn)
+            m_columns.resize(column + 1);
+        m_columns[column].insert(role, values);
+        m_rowCount = newRowCount;
+        endResetModel();
+        return;
+    }
+
+    m_columns[column].insert(role, values);
+    if (m_rowCount > 0) {
+        QList<int> roles{role};
+        if (role == Qt::DisplayRole)
+            roles.append(Qt::EditRole);
+        Q_EMIT dataChanged(index(0, column), index(m_rowCount - 1, column), roles);
+    }
+}
+
+QVariantList QColumnarTableModel::columnData(int column, int role) const
+{
+    return column >= 0 && column < m_columns.size()
+        ? m_columns.at(column).value(storageRole(role)) : QVariantList{};
+}
+
+void QColumnarTableModel::clear()
+{
+    beginResetModel();
+    m_columns.clear();
+    m_horizontalHeaders.clear();
+    m_verticalHeaders.clear();
+    m_rowCount = 0;
+    endResetModel();
+}
+
+} // namespace QtCoreHelper
+
+QT_END_NAMESPACE
@@ -5,25 +5,186 @@
  * INJECT CODE
  ********************************************************************/
 
+// @snippet qhttpserver-helpers
+// Conversion of the results of Python route handlers. The handlers may
+// return str, bytes-like objects, QHttpServerResponse,
+// QHttpServerResponder.StatusCode, QFuture[QHttpServerResponse] or awaitables
+// which are resolved on the running asyncio event loop (QtAsyncio).
+namespace QHttpServerHelper {
+
+using ResponseFuture = QFuture<QHttpServerResponse>;
+using ResponsePromise = QPromise<QHttpServerResponse>;
+
+static QHttpServerResponse internalServerError()
+{
+    return QHttpServerResponse(QHttpServerResponder::StatusCode::InternalServerError);
+}
+
+// Requires the GIL, returns std::nullopt with a Python error set on failure.
+static std::optional<QHttpServerResponse> toResponse(PyObject *pyResult)
+{
+    if (pyResult == Py_None)
+        return QHttpServerResponse(QByteArray{});
+    if (PyUnicode_Check(pyResult)) { // Encode to UTF-8 directly, avoiding QString
+        Py_ssize_t size = 0;
+        const char *utf8 = Shiboken::String::toCString(pyResult, &size);
+        if (utf8 == nullptr)
+            return std::nullopt;
+        return QHttpServerResponse(QByteArray(utf8, size));
+    }
+    if (Shiboken::Buffer::checkType(pyResult)) {
+        Py_buffer view;
+        if (PyObject_GetBuffer(pyResult, &view, PyBUF_SIMPLE) != 0)
+            return std::nullopt;
+        QByteArray data(static_cast<const char *>(view.buf), view.len);
+        PyBuffer_Release(&view);
+        return QHttpServerResponse(data);
+    }
+    if (%CHECKTYPE[QHttpServerResponse *](pyResult)) {
+        // QHttpServerResponse is move-only, the Python object is left empty.
+        auto *response = %CONVERTTOCPP[QHttpServerResponse *](pyResult);
+        return QHttpServerResponse(std::move(*response));
+    }
+    if (%CHECKTYPE[QHttpServerResponder::StatusCode](pyResult))
+        return QHttpServerResponse(%CONVERTTOCPP[QHttpServerResponder::StatusCode](pyResult));
+    PyErr_Format(PyExc_TypeError,
+                 "A route handler returned an unsupported type: %s",
+                 Py_TYPE(pyResult)->tp_name);
+    return std::nullopt;
+}
+
+static void finish(ResponsePromise *promise, QHttpServerResponse &&response)
+{
+    promise->addResult(std::move(response));
+    promise->finish();
+}
+
+// Done callback of the task, the promise is owned by the capsule passed as self.
+static PyObject *taskDone(PyObject *capsule, PyObject *task)
+{
+    auto *promise = reinterpret_cast<ResponsePromise *>(PyCapsule_GetPointer(capsule, nullptr));
+    if (promise == nullptr || promise->future().isFinished())
+        Py_RETURN_NONE;
+    Shiboken::AutoDecRef pyResult(PyObject_CallMethod(task, "result", nullptr));
+    std::optional<QHttpServerResponse> response;
+    if (!pyResult.isNull())
+        response = toResponse(pyResult);
+    if (!response.has_value()) {
+        PyErr_Print();
+        response = internalServerError();
+    }
+    finish(promise, std::move(response.value()));
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef taskDoneMethod = {
+    "_qhttpserver_task_done", reinterpret_cast<PyCFunction>(taskDone), METH_O, nullptr
+};
+
+static void deletePromise(PyObject *capsule)
+{
+    auto *promise = reinterpret_cast<ResponsePromise *>(PyCapsule_GetPointer(capsule, nullptr));
+    if (!promise->future().isFinished()) // The task was dropped without completing
+        finish(promise, internalServerError());
+    delete promise;
+}
+
+// Schedule an awaitable on the running event loop and return a future for
+// the response it produces. Returns an invalid future with a Python error set
+// on failure.
+static ResponseFuture awaitResponse(PyObject *awaitable)
+{
+    static PyObject *const asyncio = PyImport_ImportModule("asyncio");
+    if (asyncio == nullptr)
+        return {};
+    Shiboken::AutoDecRef loop(PyObject_CallMethod(asyncio, "get_running_loop", nullptr));
+    if (loop.isNull())
+        return {};
+    Shiboken::AutoDecRef task(PyObject_CallMethod(asyncio, "ensure_future", "O", awaitable));
+    if (task.isNull())
+        return {};
+
+    auto *promise = new ResponsePromise;
+    promise->start();
+    ResponseFuture result = promise->future();
+    Shiboken::AutoDecRef capsule(PyCapsule_New(promise, nullptr, deletePromise));
+    if (capsule.isNull()) {
+        delete promise;
+        return {};
+    }
+    Shiboken::AutoDecRef callback(PyCFunction_New(&taskDoneMethod, capsule));
+    if (callback.isNull())
+        return {};
+    Shiboken::AutoDecRef ok(PyObject_CallMethod(task, "add_done_callback", "O", callback.object()));
+    if (ok.isNull())
+        return {};
+    return result;
+}
+
+// Convert the result of a route handler, requires the GIL.
+static ResponseFuture toResponseFuture(PyObject *pyResult)
+{
+    if (pyResult != nullptr) {
+        if (%CHECKTYPE[QFuture<QHttpServerResponse>](pyResult))
+            return %CONVERTTOCPP[QFuture<QHttpServerResponse>](pyResult);
+        if (PyObject_HasAttrString(pyResult, "__await__") != 0) {
+            ResponseFuture future = awaitResponse(pyResult);
+            if (future.isValid())
+                return future;
+        } else if (auto response = toResponse(pyResult)) {
+            return QtFuture::makeReadyValueFuture(std::move(response.value()));
+        }
+    }
+    PyErr_Print();
+    return QtFuture::makeReadyValueFuture(internalServerError());
+}
+
+// The request passed to a route handler is destroyed when the handler
+// returns, but an asynchronous handler may still access it after an await.
+// Python therefore owns a copy of it. The fallback wrapper of a request that
+// cannot be copied is invalidated by releaseRequest().
+template <class Request>
+static PyObject *requestToPython(const Request &request)
+{
+    if constexpr (std::is_copy_constructible_v<Request>) {
+        auto *copy = new Request(request);
+        PyObject *result = %CONVERTTOPYTHON[QHttpServerRequest *](copy);
+        Shiboken::Object::getOwnership(result);
+        return result;
+    } else {
+        auto *requestPtr = &request;
+        return %CONVERTTOPYTHON[QHttpServerRequest *](requestPtr);
+    }
+}
+
+static void releaseRequest(PyObject *pyRequest)
+{
+    auto *sbkRequest = reinterpret_cast<SbkObject *>(pyRequest);
+    if (!Shiboken::Object::hasOwnership(sbkRequest))
+        Shiboken::Object::invalidate(sbkRequest);
+}
+
+} // namespace QHttpServerHelper
+// @snippet qhttpserver-helpers
+
 // Note: Lambdas need to be inline, QTBUG-104481
 // @snippet qhttpserver-route
 QString rule = %CONVERTTOCPP[QString](%PYARG_1);
 auto *callable = %PYARG_2;
+Py_INCREF(callable); // Kept for the lifetime of the server
 
 bool cppResult = %CPPSELF.%FUNCTION_NAME(rule,
-                                         [callable](const QHttpServerRequest &request) -> QString {
+                                         [callable](const QHttpServerRequest &request)
+                                            -> QFuture<QHttpServerResponse> {
     Shiboken::GilState state;
-    auto *requestPtr = &request;
+    Shiboken::AutoDecRef pyRequest(QHttpServerHelper::requestToPython(request));
     Shiboken::AutoDecRef arglist(PyTuple_New(1));
-    PyTuple_SET_ITEM(arglist, 0,
-                     %CONVERTTOPYTHON[QHttpServerRequest *](requestPtr));
-    PyObject *ret = PyObject_CallObject(callable, arglist);
-    if (PyErr_Occurred())
-        PyErr_Print();
-    if (ret == nullptr)
-        return QString{};
-    QString cppResult = %CONVERTTOCPP[QString](ret);
-    return cppResult;
+    Py_INCREF(pyRequest.object());
+    PyTuple_SET_ITEM(arglist, 0, pyRequest.object());
+    Shiboken::AutoDecRef ret(PyObject_CallObject(callable, arglist));
+    auto result = QHttpServerHelper::toResponseFuture(ret);
+    QHttpServerHelper::releaseRequest(pyRequest);
+    return result;
 });
 
 %PYARG_0 = %CONVERTTOPYTHON[bool](cppResult);
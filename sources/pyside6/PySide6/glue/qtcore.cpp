@@ -178,13 +178,13 @@ static bool isEquivalentSettingsType(PyTypeObject *typeObj, int metaTypeId)
 // PySide-535: Allow for empty dict instead of nullptr in PyPy
 QVariant out;
 if ((kwds && PyDict_Size(kwds) > 0) || numArgs > 1) {
-    Py_BEGIN_ALLOW_THREADS
+    %BEGIN_ALLOW_THREADS
     out = %CPPSELF.value(%1, %2);
-    Py_END_ALLOW_THREADS
+    %END_ALLOW_THREADS
 } else {
-    Py_BEGIN_ALLOW_THREADS
+    %BEGIN_ALLOW_THREADS
     out = %CPPSELF.value(%1);
-    Py_END_ALLOW_THREADS
+    %END_ALLOW_THREADS
 }
 
 PyTypeObject *typeObj = reinterpret_cast<PyTypeObject*>(%PYARG_3);
@@ -394,10 +394,10 @@ PyModule_AddStringConstant(module, "__version__", qVersion());
 // qFatal doesn't have a stream version, so we do a
 // qWarning call followed by a qFatal() call using a
 // literal.
-Py_BEGIN_ALLOW_THREADS
+%BEGIN_ALLOW_THREADS
 qWarning() << %1;
 qFatal("[A qFatal() call was made from Python code]");
-Py_END_ALLOW_THREADS
+%END_ALLOW_THREADS
 // @snippet qfatal
 
 // @snippet moduleshutdown
@@ -929,6 +929,20 @@ PepType_AS_BUFFER(Shiboken::SbkType<QByteArray>()) = &SbkQByteArrayBufferProc;
 %PYARG_0 = PyBytes_FromStringAndSize(%CPPSELF.%FUNCTION_NAME(), %CPPSELF.size());
 // @snippet qbytearray-data
 
+// @snippet qbytearray-tomemoryview
+// The capsule owns a shallow copy sharing the data, which is not detached
+// since it is never modified.
+auto *sharedData = new QByteArray(*%CPPSELF);
+Shiboken::AutoDecRef owner(PyCapsule_New(sharedData, nullptr, [](PyObject *capsule) {
+    delete reinterpret_cast<QByteArray *>(PyCapsule_GetPointer(capsule, nullptr));
+}));
+if (owner.isNull()) {
+    delete sharedData;
+    return nullptr;
+}
+%PYARG_0 = Shiboken::Buffer::newObject(sharedData->constData(), sharedData->size(), owner);
+// @snippet qbytearray-tomemoryview
+
 // @snippet qbytearray-str
 PyObject *aux = PyBytes_FromStringAndSize(%CPPSELF.constData(), %CPPSELF.size());
 if (aux == nullptr) {
@@ -981,6 +995,40 @@ auto *data = reinterpret_cast<char*>(Shiboken::Buffer::getPointer(%PYARG_1, &buf
 return PyLong_FromLong(%0);
 // @snippet qiodevice-bufferedread
 
+// @snippet qcolumnartablemodel-setcolumndata
+// Accept any sequence; numpy arrays are converted via tolist() to obtain
+// Python scalars convertible to QVariant.
+PyObject *pyValues = %PYARG_2;
+Shiboken::AutoDecRef converted(PyObject_HasAttrString(pyValues, "tolist")
+                               ? PyObject_CallMethod(pyValues, "tolist", nullptr) : nullptr);
+if (!converted.isNull())
+    pyValues = converted.object();
+else if (PyErr_Occurred())
+    return nullptr;
+Shiboken::AutoDecRef fast(PySequence_Fast(pyValues, "setColumnData() expects a sequence."));
+if (fast.isNull())
+    return nullptr;
+const Py_ssize_t size = PySequence_Fast_GET_SIZE(fast.object());
+QVariantList cppValues;
+cppValues.reserve(size);
+for (Py_ssize_t i = 0; i < size; ++i)
+    cppValues.append(%CONVERTTOCPP[QVariant](PySequence_Fast_GET_ITEM(fast.object(), i)));
+%CPPSELF.%FUNCTION_NAME(%1, cppValues, %3);
+// @snippet qcolumnartablemodel-setcolumndata
+
+// @snippet qiodevice-readinto
+Py_buffer view;
+if (PyObject_GetBuffer(%PYARG_1, &view, PyBUF_WRITABLE | PyBUF_ND) != 0)
+    return nullptr;
+const qint64 maxSize = %2 >= 0 && %2 < view.len ? %2 : qint64(view.len);
+%RETURN_TYPE %0 = 0;
+%BEGIN_ALLOW_THREADS
+%0 = %CPPSELF.read(reinterpret_cast<char *>(view.buf), maxSize);
+%END_ALLOW_THREADS
+PyBuffer_Release(&view);
+%PYARG_0 = %CONVERTTOPYTHON[%RETURN_TYPE](%0);
+// @snippet qiodevice-readinto
+
 // @snippet qiodevice-readdata
 QByteArray ba(1 + qsizetype(%2), char(0));
 %CPPSELF.%FUNCTION_NAME(ba.data(), qint64(%2));
@@ -1029,22 +1077,97 @@ auto *ptr = reinterpret_cast<uchar *>(Shiboken::Buffer::getPointer(%PYARG_1, &si
 // @snippet qtranslator-load
 
 // @snippet qtimer-singleshot-functorclass
-struct QSingleShotTimerFunctor : public Shiboken::PyObjectHolder
+// Functor calling a Python callable without arguments from a timer. It is
+// passed to the functor overloads of QTimer::singleShot() and
+// QTimer::callOnTimeout(), so that no QTimer wrapper or signal connection
+// involving dynamic slots is needed.
+// As for DynamicSlot, a bound method is split into the function and a weak
+// reference to self, so that the functor does not keep the object alive.
+// The call is skipped when it has been deleted.
+class QTimerCallbackFunctor
 {
 public:
-    using Shiboken::PyObjectHolder::PyObjectHolder;
+    explicit QTimerCallbackFunctor(PyObject *callable, bool singleShot = false) :
+        m_selfRef(weakSelf(callable)),
+        m_function(m_selfRef.isNull() ? callable : PyMethod_GET_FUNCTION(callable)),
+        m_singleShot(singleShot) {}
 
     void operator()();
+
+    // Returns the QObject a bound method or a signal instance belongs to,
+    // which is used as context so that the callback is dropped when it is
+    // destroyed (as for connect()).
+    static const QObject *context(PyObject *callable);
+
+private:
+    static Shiboken::PyObjectHolder weakSelf(PyObject *callable);
+    void release();
+
+    Shiboken::PyObjectHolder m_selfRef; // Weak reference to self of a method
+    Shiboken::PyObjectHolder m_function;
+    bool m_singleShot;
 };
 
-void QSingleShotTimerFunctor::operator()()
+Shiboken::PyObjectHolder QTimerCallbackFunctor::weakSelf(PyObject *callable)
+{
+    if (PyMethod_Check(callable) == 0)
+        return {};
+    Shiboken::AutoDecRef selfRef(PyWeakref_NewRef(PyMethod_GET_SELF(callable), nullptr));
+    if (selfRef.isNull()) { // Keep the method if self does not support weak references.
+        PyErr_Clear();
+        return {};
+    }
+    return Shiboken::PyObjectHolder(selfRef.object());
+}
+
+void QTimerCallbackFunctor::release()
+{
+    Shiboken::PyObjectHolder selfRef(std::move(m_selfRef));
+    Shiboken::PyObjectHolder function(std::move(m_function));
+}
+
+void QTimerCallbackFunctor::operator()()
 {
     Shiboken::GilState state;
-    Shiboken::AutoDecRef arglist(PyTuple_New(0));
-    Shiboken::AutoDecRef ret(PyObject_CallObject(object(), arglist));
+    if (m_function.isNull())
+        return;
+    PyObject *callable = m_function.object();
+    Shiboken::AutoDecRef method;
+    if (!m_selfRef.isNull()) {
+        Shiboken::AutoDecRef self(PyObject_CallObject(m_selfRef.object(), nullptr));
+        if (self.isNull() || self.object() == Py_None) {
+            PyErr_Clear();
+            release();
+            return;
+        }
+        method.reset(PepExt_Type_CallDescrGet(callable, self.object(), nullptr));
+        callable = method.object();
+    }
+    if (callable != nullptr) {
+#if defined(Py_LIMITED_API) || defined(PYPY_VERSION)
+        Shiboken::AutoDecRef ret(PyObject_CallObject(callable, nullptr));
+#else
+        Shiboken::AutoDecRef ret(PyObject_Vectorcall(callable, nullptr, 0, nullptr));
+#endif
+    }
     if (Shiboken::Errors::occurred())
         Shiboken::Errors::storeErrorOrPrint();
-    release(); // single shot
+    if (m_singleShot)
+        release();
+}
+
+const QObject *QTimerCallbackFunctor::context(PyObject *callable)
+{
+    if (PyObject_TypeCheck(callable, PySideSignalInstance_TypeF())) {
+        auto *signalInstance = reinterpret_cast<PySideSignalInstance *>(callable);
+        return PySide::Signal::getEmitterData(signalInstance).emitter;
+    }
+    PyObject *self = nullptr;
+    if (PyMethod_Check(callable) != 0)
+        self = PyMethod_GET_SELF(callable);
+    else if (PyCFunction_Check(callable) != 0)
+        self = PyCFunction_GET_SELF(callable);
+    return self != nullptr ? PySide::convertToQObject(self, false) : nullptr;
 }
 // @snippet qtimer-singleshot-functorclass
 
@@ -1054,84 +1177,41 @@ Shiboken::AutoDecRef emptyTuple(PyTuple_New(0));
 // @snippet qtimer-singleshot-direct-mapping
 
 // @snippet qtimer-singleshot-functor
-auto msec = %1;
-if (msec == 0) {
-    if (PyObject_TypeCheck(%2, PySideSignalInstance_TypeF())) {
-        auto *signal = %PYARG_2;
-        auto cppCallback = [signal]()
-        {
-            Shiboken::GilState state;
-            Shiboken::AutoDecRef ret(PyObject_CallMethod(signal, "emit", "()"));
-            Py_DECREF(signal);
-        };
-
-        Py_INCREF(signal);
-        %CPPSELF.%FUNCTION_NAME(msec, cppCallback);
-    } else {
-        %CPPSELF.%FUNCTION_NAME(msec, QSingleShotTimerFunctor(%PYARG_2));
-    }
-} else {
-    // %FUNCTION_NAME() - disable generation of c++ function call
-    Shiboken::AutoDecRef emptyTuple(PyTuple_New(0));
-    auto *timerType = Shiboken::SbkType<QTimer>();
-    auto newFunc = reinterpret_cast<newfunc>(PepType_GetSlot(timerType, Py_tp_new));
-    auto initFunc = reinterpret_cast<initproc>(PepType_GetSlot(timerType, Py_tp_init));
-    auto *pyTimer = newFunc(Shiboken::SbkType<QTimer>(), emptyTuple, nullptr);
-    initFunc(pyTimer, emptyTuple, nullptr);
-
-    QTimer * timer = %CONVERTTOCPP[QTimer *](pyTimer);
-    timer->setSingleShot(true);
-    if (!PySide::callConnect(pyTimer, SIGNAL(timeout()), %PYARG_2))
+PyObject *callable = %PYARG_2;
+// Signal instances are emitted in the context of the object owning them.
+const QObject *context = QTimerCallbackFunctor::context(callable);
+Shiboken::AutoDecRef emitMethod;
+if (PyObject_TypeCheck(callable, PySideSignalInstance_TypeF())) {
+    emitMethod.reset(PyObject_GetAttr(callable, PySide::PySideName::qtEmit()));
+    if (emitMethod.isNull())
         return nullptr;
-
-    timer->connect(timer, &QTimer::timeout, timer, &QObject::deleteLater, Qt::DirectConnection);
-    Shiboken::Object::releaseOwnership(reinterpret_cast<SbkObject *>(pyTimer));
-    Py_XDECREF(pyTimer);
-    timer->start(msec);
+    callable = emitMethod.object();
 }
+QTimerCallbackFunctor functor(callable, true);
+if (context != nullptr)
+    %CPPSELF.%FUNCTION_NAME(%1, context, std::move(functor));
+else
+    %CPPSELF.%FUNCTION_NAME(%1, std::move(functor));
 // @snippet qtimer-singleshot-functor
 
 // @snippet qtimer-singleshot-functor-context
-auto msec = %1;
-if (msec == 0) {
-    Shiboken::AutoDecRef emptyTuple(PyTuple_New(0));
-    auto *callable = %PYARG_3;
-    auto cppCallback = [callable]()
-    {
-        Shiboken::GilState state;
-        Shiboken::AutoDecRef arglist(PyTuple_New(0));
-        Shiboken::AutoDecRef ret(PyObject_CallObject(callable, arglist));
-        Py_DECREF(callable);
-    };
-
-    Py_INCREF(callable);
-    %CPPSELF.%FUNCTION_NAME(msec, %2, cppCallback);
-} else {
-    Shiboken::AutoDecRef emptyTuple(PyTuple_New(0));
-    auto *timerType = Shiboken::SbkType<QTimer>();
-    auto newFunc = reinterpret_cast<newfunc>(PepType_GetSlot(timerType, Py_tp_new));
-    auto initFunc = reinterpret_cast<initproc>(PepType_GetSlot(timerType, Py_tp_init));
-    auto *pyTimer = newFunc(Shiboken::SbkType<QTimer>(), emptyTuple, nullptr);
-    initFunc(pyTimer, emptyTuple, nullptr);
-
-    QTimer * timer = %CONVERTTOCPP[QTimer *](pyTimer);
-    timer->setSingleShot(true);
-
-    Shiboken::AutoDecRef result(
-        PyObject_CallMethod(pyTimer, "connect", "OsOO",
-                            pyTimer,
-                            SIGNAL(timeout()),
-                            %PYARG_2,
-                            %PYARG_3)
-    );
-
-    timer->connect(timer, &QTimer::timeout, timer, &QObject::deleteLater, Qt::DirectConnection);
-    Shiboken::Object::releaseOwnership(reinterpret_cast<SbkObject *>(pyTimer));
-    Py_XDECREF(pyTimer);
-    timer->start(msec);
-}
+%CPPSELF.%FUNCTION_NAME(%1, %2, QTimerCallbackFunctor(%PYARG_3, true));
 // @snippet qtimer-singleshot-functor-context
 
+// @snippet qtimer-calltimeout
+QTimerCallbackFunctor functor(%PYARG_1);
+const QObject *context = QTimerCallbackFunctor::context(%PYARG_1);
+%RETURN_TYPE %0 = context != nullptr
+    ? %CPPSELF.%FUNCTION_NAME(context, std::move(functor))
+    : %CPPSELF.%FUNCTION_NAME(std::move(functor));
+%PYARG_0 = %CONVERTTOPYTHON[%RETURN_TYPE](%0);
+// @snippet qtimer-calltimeout
+
+// @snippet qtimer-calltimeout-context
+%RETURN_TYPE %0 = %CPPSELF.%FUNCTION_NAME(%1, QTimerCallbackFunctor(%PYARG_2));
+%PYARG_0 = %CONVERTTOPYTHON[%RETURN_TYPE](%0);
+// @snippet qtimer-calltimeout-context
+
 // @snippet qprocess-startdetached
 qint64 pid;
 %RETURN_TYPE retval = %TYPE::%FUNCTION_NAME(%1, %2, %3, &pid);
@@ -1185,9 +1265,9 @@ Py_XINCREF(%PYARG_0);
 QByteArray data;
 data.resize(%2);
 int result = 0;
-Py_BEGIN_ALLOW_THREADS
+%BEGIN_ALLOW_THREADS
 result = %CPPSELF.%FUNCTION_NAME(data.data(), data.size());
-Py_END_ALLOW_THREADS
+%END_ALLOW_THREADS
 if (result == -1) {
     Py_INCREF(Py_None);
     %PYARG_0 = Py_None;
@@ -1196,21 +1276,33 @@ if (result == -1) {
 }
 // @snippet qdatastream-readrawdata
 
+// @snippet qdatastream-readrawdata-into
+Py_buffer view;
+if (PyObject_GetBuffer(%PYARG_1, &view, PyBUF_WRITABLE | PyBUF_ND) != 0)
+    return nullptr;
+%RETURN_TYPE %0 = 0;
+%BEGIN_ALLOW_THREADS
+%0 = %CPPSELF.readRawData(reinterpret_cast<char *>(view.buf), view.len);
+%END_ALLOW_THREADS
+PyBuffer_Release(&view);
+%PYARG_0 = %CONVERTTOPYTHON[%RETURN_TYPE](%0);
+// @snippet qdatastream-readrawdata-into
+
 // @snippet qdatastream-writerawdata-pybuffer
 int r = 0;
 Py_ssize_t bufferLen;
 auto *data = reinterpret_cast<const char*>(Shiboken::Buffer::getPointer(%PYARG_1, &bufferLen));
-Py_BEGIN_ALLOW_THREADS
+%BEGIN_ALLOW_THREADS
 r = %CPPSELF.%FUNCTION_NAME(data, bufferLen);
-Py_END_ALLOW_THREADS
+%END_ALLOW_THREADS
 %PYARG_0 = %CONVERTTOPYTHON[int](r);
 // @snippet qdatastream-writerawdata-pybuffer
 
 // @snippet qdatastream-writerawdata
 int r = 0;
-Py_BEGIN_ALLOW_THREADS
+%BEGIN_ALLOW_THREADS
 r = %CPPSELF.%FUNCTION_NAME(%1, Shiboken::String::len(%PYARG_1));
-Py_END_ALLOW_THREADS
+%END_ALLOW_THREADS
 %PYARG_0 = %CONVERTTOPYTHON[int](r);
 // @snippet qdatastream-writerawdata
 
@@ -1284,9 +1376,9 @@ QT_END_NAMESPACE
 // @snippet use-stream-for-format-security
 // Uses the stream version for security reasons
 // see gcc man page at -Wformat-security
-Py_BEGIN_ALLOW_THREADS
+%BEGIN_ALLOW_THREADS
 %FUNCTION_NAME() << %1;
-Py_END_ALLOW_THREADS
+%END_ALLOW_THREADS
 // @snippet use-stream-for-format-security
 
 // @snippet qresource-registerResource
@@ -1300,16 +1392,16 @@ Py_END_ALLOW_THREADS
 // @snippet qstring-return
 
 // @snippet stream-write-method
-Py_BEGIN_ALLOW_THREADS
+%BEGIN_ALLOW_THREADS
 (*%CPPSELF) << %1;
-Py_END_ALLOW_THREADS
+%END_ALLOW_THREADS
 // @snippet stream-write-method
 
 // @snippet stream-read-method
 %RETURN_TYPE _cpp_result;
-Py_BEGIN_ALLOW_THREADS
+%BEGIN_ALLOW_THREADS
 (*%CPPSELF) >> _cpp_result;
-Py_END_ALLOW_THREADS
+%END_ALLOW_THREADS
 %PYARG_0 = %CONVERTTOPYTHON[%RETURN_TYPE](_cpp_result);
 // @snippet stream-read-method
 
@@ -1319,22 +1411,73 @@ QString &res = *%0;
 // @snippet return-qstring-ref
 
 // @snippet return-readData
+// Accept bytes, bytearray, QByteArray, memoryview or any other object
+// providing a contiguous buffer, falling back to str.
 %RETURN_TYPE %0 = 0;
-if (PyBytes_Check(%PYARG_0)) {
-    %0 = PyBytes_GET_SIZE(%PYARG_0.object());
-    memcpy(%1, PyBytes_AS_STRING(%PYARG_0.object()), %0);
+if (PyObject_CheckBuffer(%PYARG_0.object())) {
+    Py_buffer view;
+    if (PyObject_GetBuffer(%PYARG_0.object(), &view, PyBUF_SIMPLE) == 0) {
+        %0 = qMin(qint64(view.len), %2);
+        memcpy(%1, view.buf, %0);
+        PyBuffer_Release(&view);
+    } else {
+        Shiboken::Errors::storePythonOverrideErrorOrPrint("QIODevice", funcName);
+        %0 = -1;
+    }
 } else if (Shiboken::String::check(%PYARG_0.object())) {
-    %0 = Shiboken::String::len(%PYARG_0.object());
+    %0 = qMin(qint64(Shiboken::String::len(%PYARG_0.object())), %2);
     memcpy(%1, Shiboken::String::toCString(%PYARG_0.object()), %0);
 }
 // @snippet return-readData
 
+// @snippet qiodevice-readdatainto-redirect
+// A Python subclass may implement readDataInto(buffer) -> int instead of or
+// in addition to readData(maxlen), which writes directly into the destination
+// buffer instead of returning a bytes object. Injected as declaration code,
+// which precedes the lookup of a readData() override, so that it is found
+// whether readData() is overridden or not.
+{
+    Shiboken::GilState readDataIntoGil;
+    static std::atomic<PyObject *> readDataIntoNameCache[2] = {};
+    Shiboken::AutoDecRef pyReadDataInto(Shiboken::BindingManager::instance().getOverride(this, readDataIntoNameCache, "readDataInto"));
+    if (pyReadDataInto.isNull()) {
+        PyErr_Clear();
+    } else {
+        Shiboken::AutoDecRef view(Shiboken::Buffer::newTemporaryObject(%1, qMax(%2, qint64(0))));
+        if (view.isNull()) {
+            Shiboken::Errors::storePythonOverrideErrorOrPrint("QIODevice", "readDataInto");
+            return -1;
+        }
+        Shiboken::AutoDecRef args(PyTuple_Pack(1, view.object()));
+        Shiboken::AutoDecRef pyResult(PyObject_Call(pyReadDataInto, args, nullptr));
+        if (pyResult.isNull()) {
+            Shiboken::Errors::storePythonOverrideErrorOrPrint("QIODevice", "readDataInto");
+            if (!Shiboken::Buffer::releaseTemporaryObject(view))
+                PyErr_Print();
+            return -1;
+        }
+        // Do not let a view on the destination buffer outlive the call
+        if (!Shiboken::Buffer::releaseTemporaryObject(view)) {
+            Shiboken::Errors::storePythonOverrideErrorOrPrint("QIODevice", "readDataInto");
+            return -1;
+        }
+        const qint64 result = PyLong_AsLongLong(pyResult);
+        if (result == -1 && PyErr_Occurred()) {
+            Shiboken::Errors::storePythonOverrideErrorOrPrint("QIODevice", "readDataInto");
+            return -1;
+        }
+        return qMin(result, %2);
+    }
+}
+// @snippet qiodevice-readdatainto-redirect
+
 // @snippet qiodevice-readData
-QByteArray ba(1 + qsizetype(%2), char(0));
-Py_BEGIN_ALLOW_THREADS
-%CPPSELF.%FUNCTION_NAME(ba.data(), qint64(%2));
-Py_END_ALLOW_THREADS
-%PYARG_0 = Shiboken::String::fromCString(ba.constData());
+QByteArray ba(qsizetype(%2), Qt::Uninitialized);
+qint64 bytesRead = 0;
+%BEGIN_ALLOW_THREADS
+bytesRead = %CPPSELF.%FUNCTION_NAME(ba.data(), qint64(%2));
+%END_ALLOW_THREADS
+%PYARG_0 = PyBytes_FromStringAndSize(ba.constData(), qMax(bytesRead, qint64(0)));
 // @snippet qiodevice-readData
 
 // @snippet qt-module-shutdown
@@ -1772,15 +1915,146 @@ auto cppCallback = [callable]()
 
 // @snippet qthreadpool-start
 Py_INCREF(callable);
+%BEGIN_ALLOW_THREADS
 %CPPSELF.%FUNCTION_NAME(cppCallback, %2);
+%END_ALLOW_THREADS
 // @snippet qthreadpool-start
 
 // @snippet qthreadpool-trystart
 Py_INCREF(callable);
+%BEGIN_ALLOW_THREADS
 %RETURN_TYPE %0 = %CPPSELF.%FUNCTION_NAME(cppCallback);
+%END_ALLOW_THREADS
 %PYARG_0 = %CONVERTTOPYTHON[int](cppResult);
 // @snippet qthreadpool-trystart
 
+// @snippet qthreadpool-map-batchclass
+// Shared state of a QThreadPool.map() call. Instead of one runnable per
+// argument, at most maxThreadCount() runnables are started, each of which
+// fetches the next argument by an atomic index. The results are collected
+// into a list which is set on a concurrent.futures.Future by the last
+// runnable to finish.
+class QThreadPoolMapBatch
+{
+public:
+    Q_DISABLE_COPY_MOVE(QThreadPoolMapBatch)
+
+    // Steals the references
+    explicit QThreadPoolMapBatch(PyObject *callable, PyObject *arguments,
+                                 PyObject *results, PyObject *future) :
+        m_callable(callable), m_arguments(arguments), m_results(results),
+        m_future(future), m_size(PyList_Size(arguments))
+    {
+    }
+
+    // The batch is shared by its runnables; it completes the future when the
+    // last of them has run or was dropped by the pool (QThreadPool.clear(),
+    // deletion of the pool) without running.
+    ~QThreadPoolMapBatch();
+
+    void run();
+
+private:
+    PyObject *m_callable;
+    PyObject *m_arguments;
+    PyObject *m_results;
+    PyObject *m_future;
+    PyObject *m_error = nullptr;
+    const Py_ssize_t m_size;
+    std::atomic<Py_ssize_t> m_next{0};
+};
+
+void QThreadPoolMapBatch::run()
+{
+    Shiboken::GilState state;
+    for (Py_ssize_t i = m_next++; i < m_size && m_error == nullptr; i = m_next++) {
+        PyObject *argument = PyList_GetItem(m_arguments, i);
+        PyObject *result = PyObject_CallFunctionObjArgs(m_callable, argument, nullptr);
+        if (result == nullptr) {
+            // Report the first error only and skip the remaining calls
+            PyObject *type{};
+            PyObject *traceback{};
+            PyErr_Fetch(&type, &m_error, &traceback);
+            PyErr_NormalizeException(&type, &m_error, &traceback);
+            if (traceback != nullptr)
+                PyException_SetTraceback(m_error, traceback);
+            Py_XDECREF(type);
+            Py_XDECREF(traceback);
+            break;
+        }
+        PyList_SetItem(m_results, i, result);
+    }
+}
+
+QThreadPoolMapBatch::~QThreadPoolMapBatch()
+{
+    if (Py_IsInitialized() == 0)
+        return;
+    Shiboken::GilState state;
+    PyObject *ret = nullptr;
+    if (m_error != nullptr) {
+        ret = PyObject_CallMethod(m_future, "set_exception", "O", m_error);
+    } else if (m_next.load() < m_size) { // No runnable ran
+        Shiboken::AutoDecRef futuresModule(PyImport_ImportModule("concurrent.futures"));
+        Shiboken::AutoDecRef cancelled(futuresModule.isNull()
+            ? nullptr : PyObject_CallMethod(futuresModule, "CancelledError", "s",
+                                            "The runnables were removed from the QThreadPool"));
+        if (!cancelled.isNull())
+            ret = PyObject_CallMethod(m_future, "set_exception", "O", cancelled.object());
+    } else {
+        ret = PyObject_CallMethod(m_future, "set_result", "O", m_results);
+    }
+    Py_XDECREF(ret);
+    if (Shiboken::Errors::occurred())
+        PyErr_Print();
+    Py_XDECREF(m_error);
+    Py_DECREF(m_future);
+    Py_DECREF(m_results);
+    Py_DECREF(m_arguments);
+    Py_DECREF(m_callable);
+}
+// @snippet qthreadpool-map-batchclass
+
+// @snippet qthreadpool-map
+Shiboken::AutoDecRef arguments(PySequence_List(%PYARG_2));
+if (arguments.isNull())
+    return nullptr;
+Shiboken::AutoDecRef futuresModule(PyImport_ImportModule("concurrent.futures"));
+if (futuresModule.isNull())
+    return nullptr;
+Shiboken::AutoDecRef future(PyObject_CallMethod(futuresModule, "Future", nullptr));
+if (future.isNull())
+    return nullptr;
+// The batch cannot be cancelled once submitted
+Shiboken::AutoDecRef running(PyObject_CallMethod(future, "set_running_or_notify_cancel",
+                                                 nullptr));
+if (running.isNull())
+    return nullptr;
+
+const Py_ssize_t size = PyList_Size(arguments);
+if (size == 0) {
+    Shiboken::AutoDecRef ret(PyObject_CallMethod(future, "set_result", "N", PyList_New(0)));
+    if (ret.isNull())
+        return nullptr;
+} else {
+    PyObject *results = PyList_New(size);
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        Py_INCREF(Py_None);
+        PyList_SetItem(results, i, Py_None);
+    }
+    const int runnables = int(std::min(Py_ssize_t(std::max(%CPPSELF.maxThreadCount(), 1)), size));
+    Py_INCREF(%PYARG_1);
+    Py_INCREF(future.object());
+    auto batch = std::make_shared<QThreadPoolMapBatch>(%PYARG_1, arguments.release(), results,
+                                                       future.object());
+    %BEGIN_ALLOW_THREADS
+    for (int r = 0; r < runnables; ++r)
+        %CPPSELF.start([batch]() { batch->run(); }, %3);
+    %END_ALLOW_THREADS
+}
+%PYARG_0 = future.release();
+// @snippet qthreadpool-map
+
 // @snippet repr-qevent
 QString result;
 QDebug(&result).nospace() << "<PySide6.QtCore.QEvent(" << %CPPSELF->type() << ")>";
@@ -2088,9 +2362,9 @@ auto callback = [callable, arg_qpermission](const QPermission &permission) -> vo
 };
 Py_INCREF(callable);
 
-Py_BEGIN_ALLOW_THREADS
+%BEGIN_ALLOW_THREADS
 %CPPSELF.%FUNCTION_NAME(permission, %2, callback);
-Py_END_ALLOW_THREADS
+%END_ALLOW_THREADS
 // @snippet qcoreapplication-requestpermission
 
 // @snippet qlockfile-getlockinfo
@@ -15,6 +15,23 @@ PyTuple_SET_ITEM(%PYARG_0, 1, %CONVERTTOPYTHON[QHostAddress](ha));
 PyTuple_SET_ITEM(%PYARG_0, 2, %CONVERTTOPYTHON[quint16](port));
 // @snippet qudpsocket-readdatagram
 
+// @snippet qudpsocket-readdatagram-into
+Py_buffer view;
+if (PyObject_GetBuffer(%PYARG_1, &view, PyBUF_WRITABLE | PyBUF_ND) != 0)
+    return nullptr;
+QHostAddress ha;
+quint16 port = 0;
+qint64 retval = 0;
+%BEGIN_ALLOW_THREADS
+retval = %CPPSELF.readDatagram(reinterpret_cast<char *>(view.buf), view.len, &ha, &port);
+%END_ALLOW_THREADS
+PyBuffer_Release(&view);
+%PYARG_0 = PyTuple_New(3);
+PyTuple_SET_ITEM(%PYARG_0, 0, %CONVERTTOPYTHON[qint64](retval));
+PyTuple_SET_ITEM(%PYARG_0, 1, %CONVERTTOPYTHON[QHostAddress](ha));
+PyTuple_SET_ITEM(%PYARG_0, 2, %CONVERTTOPYTHON[quint16](port));
+// @snippet qudpsocket-readdatagram-into
+
 // @snippet qhostinfo-lookuphost-functor
 struct QHostInfoFunctor : public Shiboken::PyObjectHolder
 {
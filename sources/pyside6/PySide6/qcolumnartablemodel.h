@@ -0,0 +1,64 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QCOLUMNARTABLEMODEL_H
+#define QCOLUMNARTABLEMODEL_H
+
+#include <QtCore/qabstractitemmodel.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qvariant.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtCoreHelper
+{
+
+// A table model storing its data column-wise per role in C++, so that views
+// can query data(), multiData() and headerData() without calling into Python.
+// Python code provides whole columns via setColumnData().
+class QColumnarTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    explicit QColumnarTableModel(QObject *parent = nullptr);
+    ~QColumnarTableModel() override;
+
+    int rowCount(const QModelIndex &parent = {}) const override;
+    int columnCount(const QModelIndex &parent = {}) const override;
+
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    void multiData(const QModelIndex &index, QModelRoleDataSpan roleDataSpan) const override;
+    bool setData(const QModelIndex &index, const QVariant &value,
+                 int role = Qt::EditRole) override;
+
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+    bool setHeaderData(int section, Qt::Orientation orientation, const QVariant &value,
+                       int role = Qt::EditRole) override;
+
+    void setColumnCount(int columns);
+    void setColumnData(int column, const QVariantList &values, int role = Qt::DisplayRole);
+    QVariantList columnData(int column, int role = Qt::DisplayRole) const;
+    void clear();
+
+private:
+    using RoleColumns = QHash<int, QVariantList>; // role -> values
+    using RoleValues = QHash<int, QVariant>; // role -> value
+
+    static int storageRole(int role) { return role == Qt::EditRole ? Qt::DisplayRole : role; }
+    const QVariant &value(int row, int column, int role) const;
+    int calculateRowCount(int skipColumn = -1, int skipRole = -1) const;
+
+    QList<RoleColumns> m_columns;
+    QHash<int, RoleValues> m_horizontalHeaders; // section -> values
+    QHash<int, RoleValues> m_verticalHeaders;
+    int m_rowCount = 0;
+};
+
+} // namespace QtCoreHelper
+
+QT_END_NAMESPACE
+
+#endif // QCOLUMNARTABLEMODEL_H
@@ -231,23 +231,74 @@ macro(create_pyside_module)
         list(APPEND shiboken_command "--framework-include-paths=${shiboken_framework_include_dirs}")
     endif()
 
+    # Record the transitive dependencies of the module for the modules
+    # depending on it.
+    set(module_all_deps ${${module_DEPS}})
+    foreach(module_dep ${${module_DEPS}})
+        get_property(module_dep_deps GLOBAL PROPERTY "pyside_module_deps_${module_dep}")
+        list(APPEND module_all_deps ${module_dep_deps})
+    endforeach()
+    list(REMOVE_DUPLICATES module_all_deps)
+    set_property(GLOBAL PROPERTY "pyside_module_deps_${module_NAME}" ${module_all_deps})
+
+    # Save the parsed headers as precompiled header and use the one of the
+    # dependency which covers all other dependencies (transitively) so that the
+    # headers of the base modules are not parsed again by clang. Since only one
+    # precompiled header can be used, modules depending on unrelated modules
+    # (for example, Qt3DCore on QtGui and QtNetwork) parse all headers.
+    set(pch_output "")
+    set(pch_input "")
+    if(PYSIDE_SHARE_PARSED_DEPENDENCIES)
+        set(pch_output "${CMAKE_CURRENT_BINARY_DIR}/${module_NAME}.pch")
+        list(APPEND shiboken_command "--clang-pch-output=${pch_output}")
+        foreach(module_dep ${${module_DEPS}})
+            get_property(module_dep_deps GLOBAL PROPERTY "pyside_module_deps_${module_dep}")
+            set(pch_uncovered_deps ${module_all_deps})
+            list(REMOVE_ITEM pch_uncovered_deps ${module_dep} ${module_dep_deps})
+            if(NOT pch_uncovered_deps)
+                set(pch_input "${pyside_binary_dir}/${module_dep}/${module_dep}.pch")
+                list(APPEND shiboken_command "--clang-pch=${pch_input}")
+                break()
+            endif()
+        endforeach()
+    endif()
+
     if(${module_DROPPED_ENTRIES})
         list(JOIN ${module_DROPPED_ENTRIES} "\;" dropped_entries)
         list(APPEND shiboken_command "\"--drop-type-entries=${dropped_entries}\"")
     endif()
 
+    # Let shiboken list the headers, typesystem and glue files it read so that
+    # it is rerun when any of them changes (CMake 3.20 supports DEPFILE for all
+    # generators and transforms the paths for Ninja with policy CMP0116).
+    set(generator_depfile_option "")
+    if(POLICY CMP0116)
+        set(generator_depfile "${CMAKE_CURRENT_BINARY_DIR}/mjb_rejected_classes.log.d")
+        list(APPEND shiboken_command "--depfile=${generator_depfile}")
+        set(generator_depfile_option DEPFILE "${generator_depfile}")
+        cmake_policy(PUSH)
+        cmake_policy(SET CMP0116 NEW)
+    endif()
+
     list(APPEND shiboken_command "${pyside6_BINARY_DIR}/${module_NAME}_global.h"
          ${typesystem_path})
 
     add_custom_command( OUTPUT "${CMAKE_CURRENT_BINARY_DIR}/mjb_rejected_classes.log"
+                               ${pch_output}
                         BYPRODUCTS ${${module_SOURCES}}
                         COMMAND ${shiboken_command}
                         DEPENDS ${total_type_system_files}
                                 ${module_GLUE_SOURCES}
                                 ${${module_NAME}_glue_dependency}
+                                ${pch_input}
+                        ${generator_depfile_option}
                         WORKING_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}
                         COMMENT "Running generator for ${module_NAME}...")
 
+    if(POLICY CMP0116)
+        cmake_policy(POP)
+    endif()
+
     include_directories(${module_NAME} ${${module_INCLUDE_DIRS}} ${pyside6_SOURCE_DIR})
     add_library(${module_NAME} MODULE ${${module_SOURCES}}
                                       ${${module_STATIC_SOURCES}})
@@ -102,6 +102,7 @@ find_package(Qt6 REQUIRED COMPONENTS Core)
 add_definitions(${Qt${QT_MAJOR_VERSION}Core_DEFINITIONS})
 
 option(BUILD_TESTS "Build tests." TRUE)
+option(PYSIDE_SHARE_PARSED_DEPENDENCIES "Pass the headers parsed by shiboken for a module as precompiled header to the modules depending on it." FALSE)
 option(ENABLE_VERSION_SUFFIX "Used to use current version in suffix to generated files. This is used to allow multiples versions installed simultaneous." FALSE)
 set(LIB_SUFFIX "" CACHE STRING "Define suffix of directory name (32/64)" )
 set(LIB_INSTALL_DIR "lib${LIB_SUFFIX}" CACHE PATH "The subdirectory relative to the install prefix where libraries will be installed (default is /lib${LIB_SUFFIX})" FORCE)
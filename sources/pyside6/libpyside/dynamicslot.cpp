@@ -10,6 +10,7 @@
 #include <autodecref.h>
 #include <gilstate.h>
 #include <pep384ext.h>
+#include <sbkmutex.h>
 
 #include <QtCore/QDebug>
 #include <QtCore/QtCompare>
@@ -17,6 +18,8 @@
 #include <QtCore/QHash>
 #include <QtCore/QPointer>
 
+#include <mutex>
+
 namespace PySide
 {
 
@@ -291,6 +294,9 @@ QDebug operator<<(QDebug debug, const QMetaObject::Connection &c)
 using ConnectionHash = QHash<ConnectionKey, QMetaObject::Connection>;
 
 static ConnectionHash connectionHash;
+// Protects connectionHash (free-threaded build). Disconnecting may delete
+// slot objects which call into Python, so that is done with the lock released.
+static Shiboken::Mutex connectionHashMutex;
 
 static ConnectionKey connectionKey(const QObject *sender, int senderIndex,
                                    PyObject *callback)
@@ -333,6 +339,7 @@ public Q_SLOTS:
 
 void SenderSignalDeletionTracker::senderDestroyed(QObject *o)
 {
+    std::lock_guard<Shiboken::Mutex> guard(connectionHashMutex);
     for (auto it = connectionHash.begin(); it != connectionHash.end(); ) {
         if (it.key().sender == o)
             it = connectionHash.erase(it);
@@ -345,41 +352,42 @@ static QPointer<SenderSignalDeletionTracker> senderSignalDeletionTracker;
 
 static void disconnectReceiver(PyObject *pythonSelf)
 {
-    // A check for reentrancy was added for PYSIDE-88, but has not been
-    // observed yet.
-    for (bool keepGoing = true; keepGoing; ) {
-        keepGoing = false;
+    // PYSIDE-88: A disconnection can cause the deletion of further objects
+    // by a re-entrant call; take the connections out of the hash first.
+    QList<QMetaObject::Connection> connections;
+    {
+        std::lock_guard<Shiboken::Mutex> guard(connectionHashMutex);
         for (auto it = connectionHash.begin(); it != connectionHash.end(); ) {
             if (it.key().object == pythonSelf) {
-                const auto oldSize = connectionHash.size();
-                QObject::disconnect(it.value());
+                connections.append(it.value());
                 it = connectionHash.erase(it);
-                // Check for a disconnection causing deletion of further objects
-                // by a re-entrant call.
-                if (connectionHash.size() < oldSize - 1) {
-                    keepGoing = true;
-                    break; // Iterators were invalidated, retry
-                }
             } else {
                 ++it;
             }
         }
     }
+    for (const auto &connection : std::as_const(connections))
+        QObject::disconnect(connection);
 }
 
 static void clearConnectionHash()
 {
+    std::lock_guard<Shiboken::Mutex> guard(connectionHashMutex);
     connectionHash.clear();
 }
 
 void registerSlotConnection(QObject *source, int signalIndex, PyObject *callback,
                             const QMetaObject::Connection &connection)
 {
-    connectionHash.insert(connectionKey(source, signalIndex, callback), connection);
-    if (senderSignalDeletionTracker.isNull()) {
-        auto *app = QCoreApplication::instance();
-        senderSignalDeletionTracker = new SenderSignalDeletionTracker(app);
-        Py_AtExit(clearConnectionHash);
+    const auto key = connectionKey(source, signalIndex, callback);
+    {
+        std::lock_guard<Shiboken::Mutex> guard(connectionHashMutex);
+        connectionHash.insert(key, connection);
+        if (senderSignalDeletionTracker.isNull()) {
+            auto *app = QCoreApplication::instance();
+            senderSignalDeletionTracker = new SenderSignalDeletionTracker(app);
+            Py_AtExit(clearConnectionHash);
+        }
     }
 
     QObject::connect(source, &QObject::destroyed,
@@ -389,13 +397,18 @@ void registerSlotConnection(QObject *source, int signalIndex, PyObject *callback
 
 bool disconnectSlot(QObject *source, int signalIndex, PyObject *callback)
 {
-    auto it = connectionHash.find(connectionKey(source, signalIndex, callback));
-    const bool ok = it != connectionHash.end();
-    if (ok) {
-        QObject::disconnect(it.value());
+    const auto key = connectionKey(source, signalIndex, callback);
+    QMetaObject::Connection connection;
+    {
+        std::lock_guard<Shiboken::Mutex> guard(connectionHashMutex);
+        auto it = connectionHash.find(key);
+        if (it == connectionHash.end())
+            return false;
+        connection = it.value();
         connectionHash.erase(it);
     }
-    return ok;
+    QObject::disconnect(connection);
+    return true;
 }
 
 } // namespace PySide
@@ -20,6 +20,8 @@
 #include "pysideslot_p.h"
 #include "pysidemetafunction_p.h"
 #include "pysidemetafunction.h"
+#include "pysideasyncio_p.h"
+#include "pysidegilbatch_p.h"
 #include "dynamicqmetaobject.h"
 #include "feature_select.h"
 #include "pysidelogging_p.h"
@@ -97,6 +99,7 @@ void init(PyObject *module)
     Property::init(module);
     ClassProperty::init(module);
     MetaFunction::init(module);
+    Asyncio::init(module);
     // Init signal manager, so it will register some meta types used by QVariant.
     SignalManager::init();
     initQApp();
@@ -533,11 +536,15 @@ static int qAppInputHook()
 #ifndef Q_OS_WIN
     // Check for press on stdin (file descriptor 0)
     pollfd stdinPfd =  qt_make_pollfd(0, POLLIN);
-    while (qt_safe_poll(&stdinPfd, 1, QDeadlineTimer{1}) == 0)
+    while (qt_safe_poll(&stdinPfd, 1, QDeadlineTimer{1}) == 0) {
         QCoreApplication::processEvents({}, 50000);
+        GilBatch::releaseBatch();
+    }
 #else
-    while (_kbhit() == 0)
+    while (_kbhit() == 0) {
         QCoreApplication::processEvents({}, 50000);
+        GilBatch::releaseBatch();
+    }
 #endif
     return 0;
 }
@@ -0,0 +1,530 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "pysideasyncio_p.h"
+
+#include <autodecref.h>
+#include <gilstate.h>
+#include <sbkerrors.h>
+#include <sbkstring.h>
+#include <shiboken.h>
+#include <signature.h>
+
+#include <QtCore/QBasicTimer>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QEvent>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QMutex>
+#include <QtCore/QObject>
+#include <QtCore/QSocketNotifier>
+#include <QtCore/QThread>
+#include <QtCore/QTimer>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace PySide::Asyncio {
+
+// Run and release a handle, requires the GIL.
+static void runHandle(PyObject *handle)
+{
+    static PyObject *const cbName = Shiboken::String::createStaticString("_cb");
+    Shiboken::AutoDecRef result(PyObject_CallMethodObjArgs(handle, cbName, nullptr));
+    if (result.isNull())
+        Shiboken::Errors::storeErrorOrPrint();
+    Py_DECREF(handle);
+}
+
+// The ready queue, the timer heap and the file descriptor watchers of a
+// QAsyncioEventLoop. The entries are QAsyncioHandle instances whose _cb()
+// method runs the callback. All handles that are ready are run in one batch
+// per posted event, so scheduling a callback does not need a timer or a
+// functor per handle.
+class Scheduler : public QObject
+{
+public:
+    Scheduler() = default;
+    ~Scheduler() override;
+
+    // Monotonic clock in nanoseconds, the base of QAsyncioEventLoop.time().
+    static qint64 now()
+    {
+        using namespace std::chrono;
+        return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+    }
+
+    void callSoon(PyObject *handle, bool threadSafe);
+    void callAt(qint64 deadline, PyObject *handle);
+    // Return the handle previously watching \a fd (new reference) or nullptr.
+    PyObject *addWatcher(qintptr fd, QSocketNotifier::Type type, PyObject *handle);
+    PyObject *removeWatcher(qintptr fd, QSocketNotifier::Type type);
+    void clear();
+
+protected:
+    bool event(QEvent *event) override;
+    void timerEvent(QTimerEvent *event) override;
+
+private:
+    struct TimerEntry
+    {
+        qint64 deadline;
+        quint64 sequence; // Keeps the order of handles with the same deadline
+        PyObject *handle;
+    };
+
+    struct Watcher
+    {
+        QSocketNotifier *notifier;
+        PyObject *handle;
+    };
+    using Watchers = QHash<qintptr, Watcher>;
+
+    static bool laterTimer(const TimerEntry &e1, const TimerEntry &e2)
+    {
+        return e1.deadline != e2.deadline ? e1.deadline > e2.deadline : e1.sequence > e2.sequence;
+    }
+
+    static QEvent::Type batchEventType()
+    {
+        static const auto result = QEvent::Type(QEvent::registerEventType());
+        return result;
+    }
+
+    bool isOwnThread() const { return QThread::currentThread() == thread(); }
+    static void runInCurrentThread(qint64 deadline, PyObject *handle);
+    void addTimer(qint64 deadline, PyObject *handle);
+    void post();
+    void runBatch();
+    void scheduleTimer();
+    void watcherActivated(qintptr fd, QSocketNotifier::Type type);
+
+    QList<PyObject *> m_ready;
+    std::vector<TimerEntry> m_timers; // Heap ordered by laterTimer()
+    quint64 m_timerSequence = 0;
+    QBasicTimer m_timer;
+    qint64 m_timerDeadline = -1;
+
+    Watchers m_watchers[2]; // Indexed by QSocketNotifier::Read/Write
+
+    QMutex m_pendingMutex;
+    QList<PyObject *> m_pending; // Handles scheduled thread-safely from other threads
+    std::atomic<bool> m_posted{false};
+};
+
+Scheduler::~Scheduler() = default;
+
+void Scheduler::callSoon(PyObject *handle, bool threadSafe)
+{
+    Py_INCREF(handle);
+    if (isOwnThread()) {
+        m_ready.append(handle);
+        post();
+    } else if (threadSafe) {
+        {
+            QMutexLocker locker(&m_pendingMutex);
+            m_pending.append(handle);
+        }
+        post();
+    } else {
+        runInCurrentThread(0, handle);
+    }
+}
+
+void Scheduler::callAt(qint64 deadline, PyObject *handle)
+{
+    Py_INCREF(handle);
+    if (isOwnThread()) {
+        addTimer(deadline, handle);
+        scheduleTimer();
+    } else {
+        runInCurrentThread(deadline, handle);
+    }
+}
+
+// Handles scheduled non-thread-safely from another thread are run by the
+// event loop of that thread (if any) as QTimer.singleShot() would, and
+// do not wake up the loop of the scheduler.
+void Scheduler::runInCurrentThread(qint64 deadline, PyObject *handle)
+{
+    const auto delay = std::chrono::ceil<std::chrono::milliseconds>(
+        std::chrono::nanoseconds(std::max(deadline - now(), qint64(0))));
+    QTimer::singleShot(delay, Qt::PreciseTimer, [handle] {
+        Shiboken::GilState state;
+        runHandle(handle);
+    });
+}
+
+void Scheduler::addTimer(qint64 deadline, PyObject *handle)
+{
+    m_timers.push_back({deadline, m_timerSequence++, handle});
+    std::push_heap(m_timers.begin(), m_timers.end(), laterTimer);
+}
+
+PyObject *Scheduler::addWatcher(qintptr fd, QSocketNotifier::Type type, PyObject *handle)
+{
+    Py_INCREF(handle);
+    auto &watchers = m_watchers[type];
+    auto it = watchers.find(fd);
+    if (it != watchers.end()) // Replace the callback, keep the notifier
+        return std::exchange(it->handle, handle);
+
+    auto *notifier = new QSocketNotifier(fd, type, this);
+    connect(notifier, &QSocketNotifier::activated, this, [this, fd, type] {
+        watcherActivated(fd, type);
+    });
+    watchers.insert(fd, {notifier, handle});
+    return nullptr;
+}
+
+PyObject *Scheduler::removeWatcher(qintptr fd, QSocketNotifier::Type type)
+{
+    auto &watchers = m_watchers[type];
+    auto it = watchers.find(fd);
+    if (it == watchers.end())
+        return nullptr;
+    const Watcher watcher = it.value();
+    watchers.erase(it);
+    watcher.notifier->setEnabled(false);
+    watcher.notifier->deleteLater(); // We might be called from its activated() signal
+    return watcher.handle;
+}
+
+void Scheduler::watcherActivated(qintptr fd, QSocketNotifier::Type type)
+{
+    const auto &watchers = m_watchers[type];
+    auto it = watchers.constFind(fd);
+    if (it == watchers.cend())
+        return;
+    QSocketNotifier *notifier = it->notifier;
+    PyObject *handle = it->handle;
+
+    // Disarm the notifier while the callback runs, so that a level-triggered
+    // notifier does not fire again before the callback has consumed the data
+    // or removed itself, then re-arm it if it is still registered.
+    notifier->setEnabled(false);
+    Shiboken::GilState state;
+    Py_INCREF(handle);
+    runHandle(handle);
+    it = watchers.constFind(fd);
+    if (it != watchers.cend() && it->notifier == notifier)
+        notifier->setEnabled(true);
+}
+
+// Drop all handles, requires the GIL.
+void Scheduler::clear()
+{
+    QList<PyObject *> pending;
+    {
+        QMutexLocker locker(&m_pendingMutex);
+        pending.swap(m_pending);
+    }
+    for (PyObject *handle : std::as_const(pending))
+        Py_DECREF(handle);
+    for (PyObject *handle : std::as_const(m_ready))
+        Py_DECREF(handle);
+    m_ready.clear();
+    for (const auto &entry : m_timers)
+        Py_DECREF(entry.handle);
+    m_timers.clear();
+    const bool ownThread = isOwnThread();
+    for (auto &watchers : m_watchers) {
+        for (const auto &watcher : std::as_const(watchers)) {
+            if (ownThread)
+                watcher.notifier->setEnabled(false);
+            watcher.notifier->deleteLater();
+            Py_DECREF(watcher.handle);
+        }
+        watchers.clear();
+    }
+    if (ownThread) {
+        m_timer.stop();
+        m_timerDeadline = -1;
+    }
+}
+
+void Scheduler::post()
+{
+    if (!m_posted.exchange(true))
+        QCoreApplication::postEvent(this, new QEvent(batchEventType()));
+}
+
+void Scheduler::scheduleTimer()
+{
+    if (m_timers.empty()) {
+        m_timer.stop();
+        m_timerDeadline = -1;
+        return;
+    }
+    const qint64 deadline = m_timers.front().deadline;
+    if (m_timer.isActive() && deadline == m_timerDeadline)
+        return;
+    // Round up, a timer firing early would only be re-armed.
+    const auto delay = std::chrono::ceil<std::chrono::milliseconds>(
+        std::chrono::nanoseconds(std::max(deadline - now(), qint64(0))));
+    m_timer.start(delay, Qt::PreciseTimer, this);
+    m_timerDeadline = deadline;
+}
+
+void Scheduler::runBatch()
+{
+    m_posted.store(false);
+    Shiboken::GilState state;
+
+    {
+        QMutexLocker locker(&m_pendingMutex);
+        m_ready.append(std::exchange(m_pending, {}));
+    }
+
+    // Move the expired timers to the ready queue in the order of their deadlines.
+    const qint64 currentTime = now();
+    while (!m_timers.empty() && m_timers.front().deadline <= currentTime) {
+        std::pop_heap(m_timers.begin(), m_timers.end(), laterTimer);
+        m_ready.append(m_timers.back().handle);
+        m_timers.pop_back();
+    }
+
+    // Callbacks scheduled by the batch are run by the next batch, giving
+    // the Qt event loop a chance to process other events in between.
+    const QList<PyObject *> batch = std::exchange(m_ready, {});
+    for (PyObject *handle : batch)
+        runHandle(handle);
+
+    if (!m_ready.isEmpty())
+        post();
+    scheduleTimer();
+}
+
+bool Scheduler::event(QEvent *event)
+{
+    if (event->type() == batchEventType()) {
+        runBatch();
+        return true;
+    }
+    return QObject::event(event);
+}
+
+void Scheduler::timerEvent(QTimerEvent *)
+{
+    m_timer.stop();
+    m_timerDeadline = -1;
+    runBatch();
+}
+
+} // namespace PySide::Asyncio
+
+extern "C"
+{
+
+struct PySideAsyncioScheduler
+{
+    PyObject_HEAD
+    PySide::Asyncio::Scheduler *d;
+};
+
+static PySide::Asyncio::Scheduler *schedulerData(PyObject *self)
+{
+    auto *data = reinterpret_cast<PySideAsyncioScheduler *>(self)->d;
+    if (data == nullptr)
+        PyErr_SetString(PyExc_RuntimeError, "The scheduler has not been initialized.");
+    return data;
+}
+
+static int schedulerInit(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    if (PyTuple_Size(args) > 0 || (kwds != nullptr && PyDict_Size(kwds) > 0)) {
+        PyErr_SetString(PyExc_TypeError, "_QAsyncioScheduler() takes no arguments");
+        return -1;
+    }
+    auto *scheduler = reinterpret_cast<PySideAsyncioScheduler *>(self);
+    if (scheduler->d == nullptr)
+        scheduler->d = new PySide::Asyncio::Scheduler;
+    return 0;
+}
+
+static void schedulerFree(void *vself)
+{
+    auto *pySelf = reinterpret_cast<PyObject *>(vself);
+    auto *self = reinterpret_cast<PySideAsyncioScheduler *>(vself);
+    if (auto *data = self->d) {
+        data->clear();
+        if (data->thread() == QThread::currentThread())
+            delete data;
+        else
+            data->deleteLater();
+        self->d = nullptr;
+    }
+    PepExt_TypeCallFree(Py_TYPE(pySelf)->tp_base, self);
+}
+
+static PyObject *schedulerTime(PyObject * /* self */, PyObject * /* args */)
+{
+    return PyFloat_FromDouble(double(PySide::Asyncio::Scheduler::now()) / 1e9);
+}
+
+static PyObject *schedulerCallSoon(PyObject *self, PyObject *handle)
+{
+    auto *data = schedulerData(self);
+    if (data == nullptr)
+        return nullptr;
+    data->callSoon(handle, false);
+    Py_RETURN_NONE;
+}
+
+static PyObject *schedulerCallSoonThreadsafe(PyObject *self, PyObject *handle)
+{
+    auto *data = schedulerData(self);
+    if (data == nullptr)
+        return nullptr;
+    data->callSoon(handle, true);
+    Py_RETURN_NONE;
+}
+
+static PyObject *schedulerCallAt(PyObject *self, PyObject *args)
+{
+    double when{};
+    PyObject *handle{};
+    if (!PyArg_ParseTuple(args, "dO:call_at", &when, &handle))
+        return nullptr;
+    auto *data = schedulerData(self);
+    if (data == nullptr)
+        return nullptr;
+    data->callAt(std::llround(when * 1e9), handle);
+    Py_RETURN_NONE;
+}
+
+static PyObject *schedulerAddWatcher(PyObject *self, PyObject *args,
+                                     QSocketNotifier::Type type, const char *format)
+{
+    PyObject *fileObject{};
+    PyObject *handle{};
+    if (!PyArg_ParseTuple(args, format, &fileObject, &handle))
+        return nullptr;
+    const int fd = PyObject_AsFileDescriptor(fileObject);
+    if (fd < 0)
+        return nullptr;
+    auto *data = schedulerData(self);
+    if (data == nullptr)
+        return nullptr;
+    PyObject *previous = data->addWatcher(fd, type, handle);
+    if (previous == nullptr)
+        Py_RETURN_NONE;
+    return previous;
+}
+
+static PyObject *schedulerRemoveWatcher(PyObject *self, PyObject *fileObject,
+                                        QSocketNotifier::Type type)
+{
+    const int fd = PyObject_AsFileDescriptor(fileObject);
+    if (fd < 0)
+        return nullptr;
+    auto *data = schedulerData(self);
+    if (data == nullptr)
+        return nullptr;
+    PyObject *previous = data->removeWatcher(fd, type);
+    if (previous == nullptr)
+        Py_RETURN_NONE;
+    return previous;
+}
+
+static PyObject *schedulerAddReader(PyObject *self, PyObject *args)
+{
+    return schedulerAddWatcher(self, args, QSocketNotifier::Read, "OO:add_reader");
+}
+
+static PyObject *schedulerRemoveReader(PyObject *self, PyObject *fd)
+{
+    return schedulerRemoveWatcher(self, fd, QSocketNotifier::Read);
+}
+
+static PyObject *schedulerAddWriter(PyObject *self, PyObject *args)
+{
+    return schedulerAddWatcher(self, args, QSocketNotifier::Write, "OO:add_writer");
+}
+
+static PyObject *schedulerRemoveWriter(PyObject *self, PyObject *fd)
+{
+    return schedulerRemoveWatcher(self, fd, QSocketNotifier::Write);
+}
+
+static PyObject *schedulerClose(PyObject *self, PyObject * /* args */)
+{
+    if (auto *data = reinterpret_cast<PySideAsyncioScheduler *>(self)->d)
+        data->clear();
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef Scheduler_methods[] = {
+    {"add_reader", reinterpret_cast<PyCFunction>(schedulerAddReader), METH_VARARGS, nullptr},
+    {"add_writer", reinterpret_cast<PyCFunction>(schedulerAddWriter), METH_VARARGS, nullptr},
+    {"call_at", reinterpret_cast<PyCFunction>(schedulerCallAt), METH_VARARGS, nullptr},
+    {"call_soon", reinterpret_cast<PyCFunction>(schedulerCallSoon), METH_O, nullptr},
+    {"call_soon_threadsafe", reinterpret_cast<PyCFunction>(schedulerCallSoonThreadsafe),
+     METH_O, nullptr},
+    {"close", reinterpret_cast<PyCFunction>(schedulerClose), METH_NOARGS, nullptr},
+    {"remove_reader", reinterpret_cast<PyCFunction>(schedulerRemoveReader), METH_O, nullptr},
+    {"remove_writer", reinterpret_cast<PyCFunction>(schedulerRemoveWriter), METH_O, nullptr},
+    {"time", reinterpret_cast<PyCFunction>(schedulerTime), METH_NOARGS, nullptr},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+static PyTypeObject *createSchedulerType()
+{
+    PyType_Slot PySideAsyncioSchedulerType_slots[] = {
+        {Py_tp_new, reinterpret_cast<void *>(PyType_GenericNew)},
+        {Py_tp_init, reinterpret_cast<void *>(schedulerInit)},
+        {Py_tp_free, reinterpret_cast<void *>(schedulerFree)},
+        {Py_tp_dealloc, reinterpret_cast<void *>(Sbk_object_dealloc)},
+        {Py_tp_methods, reinterpret_cast<void *>(Scheduler_methods)},
+        {0, nullptr}
+    };
+
+    PyType_Spec PySideAsyncioSchedulerType_spec = {
+        "2:PySide6.QtCore._QAsyncioScheduler",
+        sizeof(PySideAsyncioScheduler),
+        0,
+        Py_TPFLAGS_DEFAULT,
+        PySideAsyncioSchedulerType_slots,
+    };
+
+    return SbkType_FromSpec(&PySideAsyncioSchedulerType_spec);
+}
+
+static PyTypeObject *PySideAsyncioScheduler_TypeF()
+{
+    static auto *type = createSchedulerType();
+    return type;
+}
+
+} // extern "C"
+
+namespace PySide::Asyncio {
+
+static const char *Scheduler_SignatureStrings[] = {
+    "PySide6.QtCore._QAsyncioScheduler(self)",
+    "PySide6.QtCore._QAsyncioScheduler.add_reader(self,fd:typing.Any,handle:typing.Any)->typing.Any",
+    "PySide6.QtCore._QAsyncioScheduler.add_writer(self,fd:typing.Any,handle:typing.Any)->typing.Any",
+    "PySide6.QtCore._QAsyncioScheduler.call_at(self,when:float,handle:typing.Any)",
+    "PySide6.QtCore._QAsyncioScheduler.call_soon(self,handle:typing.Any)",
+    "PySide6.QtCore._QAsyncioScheduler.call_soon_threadsafe(self,handle:typing.Any)",
+    "PySide6.QtCore._QAsyncioScheduler.close(self)",
+    "PySide6.QtCore._QAsyncioScheduler.remove_reader(self,fd:typing.Any)->typing.Any",
+    "PySide6.QtCore._QAsyncioScheduler.remove_writer(self,fd:typing.Any)->typing.Any",
+    "PySide6.QtCore._QAsyncioScheduler.time(self)->float",
+    nullptr}; // Sentinel
+
+void init(PyObject *module)
+{
+    if (InitSignatureStrings(PySideAsyncioScheduler_TypeF(), Scheduler_SignatureStrings) < 0)
+        return;
+
+    Py_INCREF(PySideAsyncioScheduler_TypeF());
+    PyModule_AddObject(module, "_QAsyncioScheduler",
+                       reinterpret_cast<PyObject *>(PySideAsyncioScheduler_TypeF()));
+}
+
+} // namespace PySide::Asyncio
@@ -0,0 +1,18 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef PYSIDE_ASYNCIO_P_H
+#define PYSIDE_ASYNCIO_P_H
+
+#include <sbkpython.h>
+
+namespace PySide::Asyncio {
+
+/**
+ * Init the native scheduling core of QtAsyncio (QtCore._QAsyncioScheduler)
+ */
+void init(PyObject *module);
+
+} // namespace PySide::Asyncio
+
+#endif // PYSIDE_ASYNCIO_P_H
@@ -0,0 +1,138 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "pysidegilbatch_p.h"
+
+#include <QtCore/QAbstractEventDispatcher>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QEvent>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QThread>
+#include <QtCore/QVarLengthArray>
+
+#include <chrono>
+
+namespace PySide::GilBatch {
+
+// Maximum time the GIL is kept across deliveries, matching the default
+// switch interval of Python (sys.getswitchinterval()).
+static constexpr std::chrono::milliseconds maxBatchDuration(5);
+
+// State of the main thread, only accessed from it.
+struct BatchData
+{
+    const QObject *metaCallReceiver = nullptr; // of the QMetaCallEvent being delivered
+    int metaCallLevel = -1; // GilState nesting level when it was delivered
+    // Receivers of the Python slots of the batch
+    QVarLengthArray<const QObject *, 4> receivers;
+    bool active = false;
+    std::chrono::steady_clock::time_point start;
+};
+
+static BatchData batchData;
+
+void releaseBatch()
+{
+    batchData.active = false;
+    batchData.receivers.clear();
+    if (Shiboken::GilState::hasDeferredRelease())
+        Shiboken::GilState::releaseDeferred();
+}
+
+static void addReceiver(const QObject *receiver)
+{
+    if (batchData.receivers.contains(receiver))
+        return;
+    if (batchData.receivers.size() == batchData.receivers.capacity())
+        batchData.receivers.removeFirst();
+    batchData.receivers.append(receiver);
+}
+
+// Application event filter, called by QCoreApplication::notify() for the
+// events of the main thread before delivery. A GIL kept by a previous
+// delivery is released unless the event is a queued call to a receiver
+// of the batch.
+class BatchEventFilter : public QObject
+{
+public:
+    using QObject::QObject;
+
+    bool eventFilter(QObject *watched, QEvent *event) override
+    {
+        const bool isMetaCall = event->type() == QEvent::MetaCall;
+        batchData.metaCallReceiver = isMetaCall ? watched : nullptr;
+        batchData.metaCallLevel = Shiboken::GilState::nestingLevel();
+        if (batchData.active && (!isMetaCall || !batchData.receivers.contains(watched)))
+            releaseBatch();
+        return false;
+    }
+};
+
+static bool isMainThread()
+{
+    const auto *app = QCoreApplication::instance();
+    return app != nullptr && app->thread() == QThread::currentThread();
+}
+
+// Install the event filter and make sure the GIL is released before the
+// event loop of the main thread blocks.
+static bool ensureEventFilter()
+{
+    static QPointer<QObject> eventFilter;
+    static QPointer<QAbstractEventDispatcher> dispatcher;
+    if (!isMainThread())
+        return false;
+    if (eventFilter.isNull()) {
+        auto *app = QCoreApplication::instance();
+        eventFilter = new BatchEventFilter(app);
+        app->installEventFilter(eventFilter);
+    }
+    auto *currentDispatcher = QAbstractEventDispatcher::instance();
+    if (currentDispatcher == nullptr)
+        return false;
+    if (currentDispatcher != dispatcher) {
+        QObject::connect(currentDispatcher, &QAbstractEventDispatcher::aboutToBlock,
+                         releaseBatch);
+        dispatcher = currentDispatcher;
+    }
+    return true;
+}
+
+Delivery queuedDelivery(const QObject *receiver)
+{
+    // Python slots called directly by a C++ slot being delivered do not match.
+    Delivery result;
+    if (receiver != nullptr && batchData.metaCallReceiver == receiver
+        && batchData.metaCallLevel == Shiboken::GilState::nestingLevel()
+        && isMainThread()) {
+        result.receiver = receiver;
+        batchData.metaCallReceiver = nullptr;
+    }
+    return result;
+}
+
+void endDelivery(Shiboken::GilState &gil, const Delivery &delivery)
+{
+    if (!ensureEventFilter() || !delivery.isQueued()) {
+        gil.release();
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (batchData.active && now - batchData.start >= maxBatchDuration) {
+        gil.release();
+        releaseBatch(); // Let other threads waiting for the GIL run.
+        return;
+    }
+
+    // The event filter decides whether the next event may use the GIL.
+    addReceiver(delivery.receiver);
+    gil.deferRelease();
+    if (!batchData.active) {
+        batchData.active = true;
+        batchData.start = now;
+    }
+}
+
+} // namespace PySide::GilBatch
@@ -0,0 +1,46 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef PYSIDE_GILBATCH_P_H
+#define PYSIDE_GILBATCH_P_H
+
+#include <gilstate.h>
+
+#include <QtCore/qglobal.h>
+
+QT_FORWARD_DECLARE_CLASS(QObject)
+
+// Coalesced GIL acquisition for the delivery of queued signals: After a
+// Python slot invoked from a QMetaCallEvent in the main thread, the GIL is
+// kept for a bounded interval as long as the following events are queued
+// calls to receivers of Python slots of the batch, so that their deliveries
+// do not need to acquire it again. The events are observed by an application
+// event filter, which PySide installs when delivering the first Python slot.
+// The GIL is released before any other event is delivered and before the
+// event loop blocks. Other threads do not batch deliveries, since application
+// event filters only see the events of the main thread.
+namespace PySide::GilBatch {
+
+/// Queued signal delivery (QMetaCallEvent) to a Python slot.
+struct Delivery
+{
+    const QObject *receiver = nullptr;
+
+    bool isQueued() const { return receiver != nullptr; }
+};
+
+/// Returns the queued signal delivery to \a receiver a GilState created now
+/// belongs to, or an empty Delivery.
+Delivery queuedDelivery(const QObject *receiver);
+
+/// Release the GilState of a delivery to a Python callable, keeping the GIL
+/// for the next delivery of a queued signal.
+void endDelivery(Shiboken::GilState &gil, const Delivery &delivery);
+
+/// Release a GIL kept for the batch when returning from event processing
+/// to code which does not use GilState::restoreThread() (PyOS_InputHook).
+void releaseBatch();
+
+} // namespace PySide::GilBatch
+
+#endif // PYSIDE_GILBATCH_P_H
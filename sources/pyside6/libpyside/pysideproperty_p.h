@@ -26,8 +26,8 @@ public:
 
     virtual void metaCall(PyObject *source, QMetaObject::Call call, void **args);
 
-    PyObject *getValue(PyObject *source) const;
-    int setValue(PyObject *source, PyObject *value);
+    virtual PyObject *getValue(PyObject *source) const;
+    virtual int setValue(PyObject *source, PyObject *value);
     int reset(PyObject *source);
 
     QByteArray typeName;
@@ -3,6 +3,7 @@
 
 #include "pysideqslotobject_p.h"
 #include "dynamicslot_p.h"
+#include "pysidegilbatch_p.h"
 
 #include <gilstate.h>
 
@@ -19,10 +20,12 @@ PySideQSlotObject::PySideQSlotObject(PyObject *callable,
 {
 }
 
-void PySideQSlotObject::call(void **args)
+void PySideQSlotObject::call(QObject *receiver, void **args)
 {
+    const auto delivery = GilBatch::queuedDelivery(receiver);
     Shiboken::GilState state;
     m_dynamicSlot->call(m_parameterTypes, m_returnType, args);
+    GilBatch::endDelivery(state, delivery);
 }
 
 PySideQSlotObject::~PySideQSlotObject() = default;
@@ -36,11 +39,10 @@ void PySideQSlotObject::impl(int which, QSlotObjectBase *this_, QObject *receive
         delete self;
         break;
     case Call:
-        self->call(args);
+        self->call(receiver, args);
         break;
     case Compare:
     case NumOperations:
-        Q_UNUSED(receiver);
         Q_UNUSED(args);
         Q_UNUSED(ret);
         break;
@@ -27,7 +27,7 @@ public:
 
 private:
     static void impl(int which, QSlotObjectBase *this_, QObject *receiver, void **args, bool *ret);
-    void call(void **args);
+    void call(QObject *receiver, void **args);
 
     std::unique_ptr<DynamicSlot> m_dynamicSlot;
     const QByteArrayList m_parameterTypes;
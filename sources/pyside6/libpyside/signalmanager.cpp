@@ -9,6 +9,7 @@
 #include "pyside_p.h"
 #include "dynamicqmetaobject.h"
 #include "pysidemetafunction_p.h"
+#include "pysidegilbatch_p.h"
 
 #include <autodecref.h>
 #include <basewrapper.h>
@@ -18,6 +19,7 @@
 #include <sbkstring.h>
 #include <sbkstaticstrings.h>
 #include <sbkerrors.h>
+#include <sbkmutex.h>
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QByteArrayView>
@@ -377,6 +379,7 @@ int SignalManagerPrivate::qtMethodMetacall(QObject *object,
     int result = id - metaObject->methodCount();
 
     std::unique_ptr<Shiboken::GilState> gil;
+    GilBatch::Delivery delivery;
 
     qCDebug(lcPySide).noquote().nospace() << __FUNCTION__ << " #" << id
         << " \"" << method.methodSignature() << '"';
@@ -385,6 +388,7 @@ int SignalManagerPrivate::qtMethodMetacall(QObject *object,
         // emit python signal
         QMetaObject::activate(object, id, args);
     } else {
+        delivery = GilBatch::queuedDelivery(object);
         gil.reset(new Shiboken::GilState);
         auto *pySbkSelf = Shiboken::BindingManager::instance().retrieveWrapper(object);
         Q_ASSERT(pySbkSelf);
@@ -408,6 +412,7 @@ int SignalManagerPrivate::qtMethodMetacall(QObject *object,
     if (PyErr_Occurred())
         handleMetaCallError(object, &result);
 
+    GilBatch::endDelivery(*gil, delivery);
     return result;
 }
 
@@ -640,6 +645,10 @@ static int addMetaMethod(QObject *source, const QByteArray &signature,
     }
 
     auto *pySelf = reinterpret_cast<PyObject *>(self);
+    int result = -1;
+    // Threads registering methods on the same instance must not create
+    // separate meta objects (free-threaded build).
+    SBK_BEGIN_CRITICAL_SECTION(pySelf);
     auto *dict = SbkObject_GetDict_NoRef(pySelf);
     MetaObjectBuilder *dmo = metaBuilderFromDict(dict);
     // Create a instance meta object
@@ -657,7 +666,9 @@ static int addMetaMethod(QObject *source, const QByteArray &signature,
             << "\". Consider annotating with " << slotSignature(signature);
     }
 
-    return type == QMetaMethod::Signal ? dmo->addSignal(signature) : dmo->addSlot(signature);
+    result = type == QMetaMethod::Signal ? dmo->addSignal(signature) : dmo->addSlot(signature);
+    SBK_END_CRITICAL_SECTION();
+    return result;
 }
 
 static inline void warnNullSource(const char *signature)
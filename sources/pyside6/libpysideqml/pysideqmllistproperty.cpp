@@ -11,14 +11,33 @@
 #include <pysideproperty.h>
 #include <pysideproperty_p.h>
 
+#include <QtCore/QList>
+#include <QtCore/QMetaMethod>
 #include <QtCore/QObject>
+#include <QtCore/QPointer>
 #include <QtQml/QQmlListProperty>
 
+#include <unordered_map>
+
+// List storage of an instance for ListProperty(native=True). QML accesses it
+// without entering Python; the QPointer guards against items deleted elsewhere.
+struct QmlListStorage
+{
+    QList<QPointer<QObject>> items;
+    QMetaObject::Connection destroyedConnection;
+};
+
 // This is the user data we store in the property.
 class QmlListPropertyPrivate : public PySidePropertyPrivate
 {
 public:
+    ~QmlListPropertyPrivate() override;
+
     void metaCall(PyObject *source, QMetaObject::Call call, void **args) override;
+    PyObject *getValue(PyObject *source) const override;
+    int setValue(PyObject *source, PyObject *value) override;
+
+    QmlListStorage *storage(QObject *object);
 
     PyTypeObject *type = nullptr;
     PyObject *append = nullptr;
@@ -27,6 +46,9 @@ public:
     PyObject *clear = nullptr;
     PyObject *replace = nullptr;
     PyObject *removeLast = nullptr;
+    bool native = false;
+    // Node based, the QQmlListProperty handed out to QML points into it.
+    std::unordered_map<const QObject *, QmlListStorage> nativeStorage;
 };
 
 extern "C"
@@ -46,6 +68,7 @@ static int propListTpInit(PyObject *self, PyObject *args, PyObject *kwds)
                                    "doc", "notify", // PySideProperty
                                    "designable", "scriptable", "stored",
                                    "user", "constant", "final",
+                                   "native",
                                    nullptr};
     auto *pySelf = reinterpret_cast<PySideProperty *>(self);
 
@@ -54,7 +77,7 @@ static int propListTpInit(PyObject *self, PyObject *args, PyObject *kwds)
     char *doc{};
 
     if (!PyArg_ParseTupleAndKeywords(args, kwds,
-                                     "O|OOOOOOsObbbbbb:QtQml.ListProperty",
+                                     "O|OOOOOOsObbbbbbb:QtQml.ListProperty",
                                      const_cast<char **>(kwlist),
                                      &data->type,
                                      &data->append,
@@ -70,7 +93,8 @@ static int propListTpInit(PyObject *self, PyObject *args, PyObject *kwds)
                                              &(data->stored),
                                      /*bbb*/ &(data->user),
                                              &(data->constant),
-                                             &(data->final))) {
+                                             &(data->final),
+                                     /*b*/   &(data->native))) {
         return -1;
     }
 
@@ -97,6 +121,17 @@ static int propListTpInit(PyObject *self, PyObject *args, PyObject *kwds)
         return -1;
     }
 
+    if (data->native) {
+        for (PyObject *callback : {data->append, data->count, data->at, data->clear,
+                                   data->replace, data->removeLast}) {
+            if (callback != nullptr && callback != Py_None) {
+                PyErr_SetString(PyExc_TypeError,
+                                "Callbacks cannot be combined with native list storage");
+                return -1;
+            }
+        }
+    }
+
     data->typeName = QByteArrayLiteral("QQmlListProperty<QObject>");
 
     return 0;
@@ -256,15 +291,168 @@ void propListRemoveLast(QQmlListProperty<QObject> *propList)
         PyErr_Print();
 }
 
+// QQmlListProperty<T> callbacks operating on the native storage. They are
+// invoked by the QML engine and never need the GIL.
+static inline QList<QPointer<QObject>> &nativeItems(QQmlListProperty<QObject> *propList)
+{
+    return static_cast<QmlListStorage *>(propList->data)->items;
+}
+
+static void nativeListAppend(QQmlListProperty<QObject> *propList, QObject *item)
+{
+    nativeItems(propList).append(item);
+}
+
+static qsizetype nativeListCount(QQmlListProperty<QObject> *propList)
+{
+    return nativeItems(propList).size();
+}
+
+static QObject *nativeListAt(QQmlListProperty<QObject> *propList, qsizetype index)
+{
+    const auto &items = nativeItems(propList);
+    return index >= 0 && index < items.size() ? items.at(index).data() : nullptr;
+}
+
+static void nativeListClear(QQmlListProperty<QObject> *propList)
+{
+    nativeItems(propList).clear();
+}
+
+static void nativeListReplace(QQmlListProperty<QObject> *propList, qsizetype index,
+                              QObject *value)
+{
+    auto &items = nativeItems(propList);
+    if (index >= 0 && index < items.size())
+        items[index] = value;
+}
+
+static void nativeListRemoveLast(QQmlListProperty<QObject> *propList)
+{
+    auto &items = nativeItems(propList);
+    if (!items.isEmpty())
+        items.removeLast();
+}
+
+QmlListPropertyPrivate::~QmlListPropertyPrivate()
+{
+    for (auto &entry : nativeStorage)
+        QObject::disconnect(entry.second.destroyedConnection);
+}
+
+QmlListStorage *QmlListPropertyPrivate::storage(QObject *object)
+{
+    auto it = nativeStorage.find(object);
+    if (it == nativeStorage.end()) {
+        it = nativeStorage.emplace(object, QmlListStorage{}).first;
+        it->second.destroyedConnection =
+            QObject::connect(object, &QObject::destroyed,
+                             [this, object]() { nativeStorage.erase(object); });
+    }
+    return &it->second;
+}
+
+static QObject *sourceObject(PyObject *source)
+{
+    QObject *qobj{};
+    Shiboken::Conversions::pythonToCppPointer(qObjectType(), source, &qobj);
+    return qobj;
+}
+
+// Python read access of a native list: Returns a list of the current items.
+PyObject *QmlListPropertyPrivate::getValue(PyObject *source) const
+{
+    if (!native)
+        return PySidePropertyPrivate::getValue(source);
+
+    auto it = nativeStorage.find(sourceObject(source));
+    if (it == nativeStorage.cend())
+        return PyList_New(0);
+
+    PyTypeObject *qobjectType = qObjectType();
+    const auto &items = it->second.items;
+    PyObject *result = PyList_New(0);
+    for (const auto &item : items) {
+        if (!item.isNull()) {
+            Shiboken::AutoDecRef pyItem(Shiboken::Conversions::pointerToPython(qobjectType,
+                                                                               item.data()));
+            PyList_Append(result, pyItem);
+        }
+    }
+    return result;
+}
+
+// Python write access of a native list: Replaces all items at once (instead
+// of the clear()/append() sequence QML uses) and emits the notify signal.
+int QmlListPropertyPrivate::setValue(PyObject *source, PyObject *value)
+{
+    if (!native)
+        return PySidePropertyPrivate::setValue(source, value);
+
+    if (value == nullptr) {
+        PyErr_SetString(PyExc_AttributeError, "Cannot delete a ListProperty");
+        return -1;
+    }
+
+    Shiboken::AutoDecRef sequence(PySequence_Fast(value, "A sequence of QObjects is expected"));
+    if (sequence.isNull())
+        return -1;
+
+    PyTypeObject *qobjectType = qObjectType();
+    const Py_ssize_t size = PySequence_Fast_GET_SIZE(sequence.object());
+    QList<QPointer<QObject>> items;
+    items.reserve(size);
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        PyObject *pyItem = PySequence_Fast_GET_ITEM(sequence.object(), i);
+        if (!PyType_IsSubtype(Py_TYPE(pyItem), type)) {
+            PyErr_Format(PyExc_TypeError, "Item %zd: %s expected, got %s.",
+                         i, type->tp_name, Py_TYPE(pyItem)->tp_name);
+            return -1;
+        }
+        QObject *item{};
+        Shiboken::Conversions::pythonToCppPointer(qobjectType, pyItem, &item);
+        items.append(item);
+    }
+
+    QObject *qobj = sourceObject(source);
+    storage(qobj)->items = std::move(items);
+
+    // Keep the Python items alive as long as the owner's wrapper, like a
+    // Python list attribute would.
+    const QByteArray key = "ListProperty@" + QByteArray::number(quintptr(this), 16);
+    Shiboken::AutoDecRef keptItems(PySequence_List(sequence.object()));
+    Shiboken::Object::keepReference(reinterpret_cast<SbkObject *>(source),
+                                    key.constData(), keptItems.object());
+
+    if (!notifySignature.isEmpty()) {
+        const QMetaObject *metaObject = qobj->metaObject();
+        const int index = metaObject->indexOfSignal(notifySignature.constData());
+        if (index != -1) {
+            const QMetaMethod notifySignal = metaObject->method(index);
+            if (notifySignal.parameterCount() == 0)
+                notifySignal.invoke(qobj, Qt::DirectConnection);
+        }
+    }
+    return PyErr_Occurred() ? -1 : 0;
+}
+
 // qt_metacall specialization for ListProperties
 void QmlListPropertyPrivate::metaCall(PyObject *source, QMetaObject::Call call, void **args)
 {
     if (call != QMetaObject::ReadProperty)
         return;
 
-    QObject *qobj{};
-    PyTypeObject *qobjectType = qObjectType();
-    Shiboken::Conversions::pythonToCppPointer(qobjectType, source, &qobj);
+    QObject *qobj = sourceObject(source);
+
+    if (native) {
+        *reinterpret_cast<QQmlListProperty<QObject> *>(args[0]) =
+            QQmlListProperty<QObject>(qobj, storage(qobj),
+                                      &nativeListAppend, &nativeListCount, &nativeListAt,
+                                      &nativeListClear, &nativeListReplace,
+                                      &nativeListRemoveLast);
+        return;
+    }
+
     QQmlListProperty<QObject> declProp(
         qobj, this,
         append && append != Py_None ? &propListAppender : nullptr,
@@ -281,7 +469,8 @@ void QmlListPropertyPrivate::metaCall(PyObject *source, QMetaObject::Call call,
 
 static const char *PropertyList_SignatureStrings[] = {
     "PySide6.QtQml.ListProperty(self,type:type,append:typing.Callable,"
-        "at:typing.Callable=None,clear:typing.Callable=None,count:typing.Callable=None)",
+        "at:typing.Callable=None,clear:typing.Callable=None,count:typing.Callable=None,"
+        "native:bool=False)",
     nullptr // Sentinel
 };
 
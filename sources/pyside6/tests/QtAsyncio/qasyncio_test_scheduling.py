@@ -0,0 +1,59 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+'''Test cases for QtAsyncio'''
+
+import unittest
+import asyncio
+
+from PySide6.QtAsyncio import QAsyncioEventLoopPolicy
+
+
+class QAsyncioTestCaseScheduling(unittest.TestCase):
+
+    def setUp(self) -> None:
+        super().setUp()
+        asyncio.set_event_loop_policy(QAsyncioEventLoopPolicy())
+        self.loop = asyncio.new_event_loop()
+        self.output = []
+
+    def tearDown(self) -> None:
+        self.loop.close()
+        asyncio.set_event_loop_policy(None)
+        super().tearDown()
+
+    def append_and_reschedule(self, name):
+        self.output.append(name)
+        # Scheduled by a callback: runs after the callbacks already queued.
+        self.loop.call_soon(self.output.append, f"{name}-next")
+
+    def test_call_soon_order(self):
+        for name in ("a", "b", "c"):
+            self.loop.call_soon(self.append_and_reschedule, name)
+        cancelled = self.loop.call_soon(self.output.append, "cancelled")
+        cancelled.cancel()
+        self.loop.call_later(0.05, self.loop.stop)
+        self.loop.run_forever()
+        self.assertTrue(cancelled.cancelled())
+        self.assertEqual(self.output, ["a", "b", "c", "a-next", "b-next", "c-next"])
+
+    def test_call_later_order(self):
+        start = self.loop.time()
+        self.loop.call_later(0.2, self.output.append, 3)
+        # Handles with the same deadline run in the order they were scheduled.
+        self.loop.call_at(start + 0.1, self.output.append, 2)
+        self.loop.call_at(start + 0.1, self.output.append, 2.5)
+        self.loop.call_later(0, self.output.append, 1)
+        self.loop.call_later(0.3, self.loop.stop)
+        self.loop.run_forever()
+        self.assertEqual(self.output, [1, 2, 2.5, 3])
+        self.assertGreaterEqual(self.loop.time() - start, 0.3)
+
+    def test_time_is_monotonic(self):
+        times = [self.loop.time() for _ in range(1000)]
+        self.assertEqual(times, sorted(times))
+
+
+if __name__ == '__main__':
+    unittest.main()
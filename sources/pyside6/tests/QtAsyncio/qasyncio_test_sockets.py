@@ -0,0 +1,164 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+'''Test cases for QtAsyncio'''
+
+import unittest
+import asyncio
+import socket
+
+from pathlib import Path
+
+from PySide6.QtAsyncio import QAsyncioEventLoopPolicy
+
+try:
+    import ssl
+except ImportError:
+    ssl = None
+
+# A self-signed certificate for localhost
+KEYCERT = Path(__file__).resolve().parent / "keycert.pem"
+
+
+class QAsyncioTestCaseSockets(unittest.TestCase):
+
+    def setUp(self) -> None:
+        super().setUp()
+        asyncio.set_event_loop_policy(QAsyncioEventLoopPolicy())
+        self.loop = asyncio.new_event_loop()
+        self.left, self.right = socket.socketpair()
+        self.left.setblocking(False)
+        self.right.setblocking(False)
+
+    def tearDown(self) -> None:
+        self.left.close()
+        self.right.close()
+        self.loop.close()
+        asyncio.set_event_loop_policy(None)
+        super().tearDown()
+
+    def test_add_reader(self):
+        received = []
+
+        def read():
+            received.append(self.left.recv(1024))
+            if len(received) == 2:
+                self.assertTrue(self.loop.remove_reader(self.left))
+                self.loop.stop()
+
+        self.loop.add_reader(self.left, read)
+        self.right.send(b"one")
+        self.loop.call_later(0.05, self.right.send, b"two")
+        self.loop.call_later(5, self.loop.stop)
+        self.loop.run_forever()
+        self.assertEqual(b"".join(received), b"onetwo")
+        self.assertFalse(self.loop.remove_reader(self.left))
+
+    def test_add_writer(self):
+        self.loop.add_writer(self.right, self.loop.stop)
+        self.loop.run_forever()
+        self.assertTrue(self.loop.remove_writer(self.right))
+
+    def test_sock_recv_sendall(self):
+        data = bytes(range(256)) * 4096
+
+        async def receive():
+            buffer = bytearray(len(data))
+            view = memoryview(buffer)
+            while view:
+                view = view[await self.loop.sock_recv_into(self.left, view):]
+            return bytes(buffer)
+
+        async def main():
+            receiver = asyncio.ensure_future(receive())
+            await self.loop.sock_sendall(self.right, data)
+            return await receiver
+
+        self.assertEqual(self.loop.run_until_complete(main()), data)
+
+    def test_stream_server(self):
+        async def echo(reader, writer):
+            writer.write(await reader.readline())
+            await writer.drain()
+            writer.close()
+            await writer.wait_closed()
+
+        async def main():
+            server = await asyncio.start_server(echo, "127.0.0.1", 0)
+            port = server.sockets[0].getsockname()[1]
+            reader, writer = await asyncio.open_connection("127.0.0.1", port)
+            writer.write(b"hello\n")
+            line = await reader.readline()
+            writer.close()
+            await writer.wait_closed()
+            server.close()
+            await server.wait_closed()
+            return line
+
+        self.assertEqual(self.loop.run_until_complete(main()), b"hello\n")
+
+    async def _echo_round_trip(self, host, server_ssl=None, client_ssl=None):
+        async def echo(reader, writer):
+            while data := await reader.read(65536):
+                writer.write(data)
+                await writer.drain()
+            writer.close()
+            await writer.wait_closed()
+
+        server = await asyncio.start_server(echo, "127.0.0.1", 0, ssl=server_ssl)
+        port = server.sockets[0].getsockname()[1]
+        reader, writer = await asyncio.open_connection(host, port, ssl=client_ssl)
+        data = bytes(range(256)) * 1024
+        writer.write(data)
+        await writer.drain()
+        received = await reader.readexactly(len(data))
+        writer.close()
+        await writer.wait_closed()
+        server.close()
+        await server.wait_closed()
+        return received == data
+
+    def test_stream_server_host_name(self):
+        self.assertTrue(self.loop.run_until_complete(self._echo_round_trip("localhost")))
+
+    @unittest.skipIf(ssl is None, "requires ssl")
+    def test_stream_server_tls(self):
+        server_ssl = ssl.create_default_context(ssl.Purpose.CLIENT_AUTH)
+        server_ssl.load_cert_chain(KEYCERT)
+        client_ssl = ssl.create_default_context()
+        client_ssl.load_verify_locations(KEYCERT)
+        self.assertTrue(self.loop.run_until_complete(
+            self._echo_round_trip("localhost", server_ssl, client_ssl)))
+
+    def test_sock_connect_host_name(self):
+        async def main():
+            server = await asyncio.start_server(lambda r, w: w.close(), "127.0.0.1", 0)
+            port = server.sockets[0].getsockname()[1]
+            with socket.socket() as sock:
+                sock.setblocking(False)
+                await self.loop.sock_connect(sock, ("localhost", port))
+                peer = sock.getpeername()
+            server.close()
+            await server.wait_closed()
+            return peer[1]
+
+        self.assertTrue(self.loop.run_until_complete(main()) > 0)
+
+    def test_transport_fd_is_not_watchable(self):
+        async def main():
+            server = await asyncio.start_server(lambda r, w: w.close(), "127.0.0.1", 0)
+            port = server.sockets[0].getsockname()[1]
+            reader, writer = await asyncio.open_connection("127.0.0.1", port)
+            with self.assertRaises(RuntimeError):
+                self.loop.add_reader(writer.get_extra_info("socket"), print)
+            writer.close()
+            await writer.wait_closed()
+            server.close()
+            await server.wait_closed()
+
+        self.loop.run_until_complete(main())
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -258,6 +258,19 @@ class QByteArraySliceAssignment(unittest.TestCase):
         actual_bytes = bytes(byte_array)
         self.assertEqual(orig_bytes, actual_bytes)
 
+    def testToMemoryView(self):
+        byte_array = QByteArray(b'012\x003456789')
+        view = byte_array.toMemoryView()
+        self.assertTrue(view.readonly)
+        self.assertEqual(view.tobytes(), b'012\x003456789')
+        # The view is backed by a shallow copy and unaffected by modifications
+        byte_array[0] = b'X'
+        self.assertEqual(view[0], ord('0'))
+        del byte_array
+        self.assertEqual(len(view), 11)
+        self.assertEqual(bytes(view[4:6]), b'34')
+        self.assertEqual(len(QByteArray().toMemoryView()), 0)
+
     def testUnpack(self):
         b = QByteArray(b'\x19\x00\x00\x00\xc4\t\x00\x00')
         t = struct.unpack('<ii', b)
@@ -0,0 +1,96 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+'''Test cases for the QColumnarTableModel class'''
+
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QColumnarTableModel, Qt
+
+try:
+    import numpy
+    HAVE_NUMPY = True
+except ModuleNotFoundError:
+    HAVE_NUMPY = False
+
+
+class PriceModel(QColumnarTableModel):
+    '''A Python subclass providing its data column-wise.'''
+    def __init__(self):
+        super().__init__()
+        self.setColumnData(0, ["apple", "pear", "plum"])
+        self.setColumnData(1, [1.5, 2.25, 0.75])
+        self.setColumnData(1, ["#ff0000", None, None], Qt.ItemDataRole.ToolTipRole)
+        self.setHeaderData(0, Qt.Orientation.Horizontal, "Fruit")
+        self.setHeaderData(1, Qt.Orientation.Horizontal, "Price")
+
+
+class QColumnarTableModelTest(unittest.TestCase):
+    def setUp(self):
+        self.model = PriceModel()
+        self.data_changed = []
+        self.resets = 0
+        self.model.dataChanged.connect(self._dataChanged)
+        self.model.modelReset.connect(self._modelReset)
+
+    def tearDown(self):
+        del self.model
+
+    def _dataChanged(self, topLeft, bottomRight, roles):
+        self.data_changed.append((topLeft.row(), topLeft.column(),
+                                  bottomRight.row(), bottomRight.column()))
+
+    def _modelReset(self):
+        self.resets += 1
+
+    def testData(self):
+        model = self.model
+        self.assertEqual(model.rowCount(), 3)
+        self.assertEqual(model.columnCount(), 2)
+        self.assertEqual(model.data(model.index(1, 0)), "pear")
+        self.assertEqual(model.data(model.index(1, 0), Qt.ItemDataRole.EditRole), "pear")
+        self.assertEqual(model.data(model.index(2, 1)), 0.75)
+        self.assertEqual(model.data(model.index(0, 1), Qt.ItemDataRole.ToolTipRole), "#ff0000")
+        self.assertIsNone(model.data(model.index(0, 0), Qt.ItemDataRole.ToolTipRole))
+        self.assertEqual(model.headerData(1, Qt.Orientation.Horizontal), "Price")
+        self.assertEqual(model.columnData(0), ["apple", "pear", "plum"])
+
+    def testUpdateColumn(self):
+        self.model.setColumnData(1, [3, 4, 5])
+        self.assertEqual(self.data_changed, [(0, 1, 2, 1)])
+        self.assertEqual(self.resets, 0)
+        self.assertEqual(self.model.data(self.model.index(2, 1)), 5)
+
+    def testRowCountChange(self):
+        self.model.setColumnData(0, ["apple", "pear", "plum", "fig"])
+        self.assertEqual(self.resets, 1)
+        self.assertEqual(self.model.rowCount(), 4)
+        self.model.setColumnData(0, ["apple"])
+        # The price column still determines the row count
+        self.assertEqual(self.model.rowCount(), 3)
+        self.model.clear()
+        self.assertEqual(self.model.rowCount(), 0)
+        self.assertEqual(self.model.columnCount(), 0)
+
+    def testSetData(self):
+        index = self.model.index(0, 0)
+        self.assertTrue(self.model.setData(index, "cherry"))
+        self.assertEqual(self.model.data(index), "cherry")
+        self.assertEqual(self.data_changed, [(0, 0, 0, 0)])
+
+    @unittest.skipUnless(HAVE_NUMPY, "requires numpy")
+    def testNumpy(self):
+        self.model.setColumnData(1, numpy.array([1, 2, 3], dtype=numpy.int64))
+        self.assertEqual(self.model.data(self.model.index(2, 1)), 3)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -307,6 +307,18 @@ class QDataStreamBuffer(unittest.TestCase):
         data = QDataStream(ba)
         self.assertEqual(data.readRawData(3), test_data)
 
+    def testRawDataInto(self):
+        test_data = b'AB\0CD'
+        ba = QByteArray()
+        data = QDataStream(ba, QIODevice.WriteOnly)
+        data.writeRawData(test_data)
+        data = QDataStream(ba)
+        buffer = bytearray(4)
+        self.assertEqual(data.readRawDataInto(buffer), 4)
+        self.assertEqual(buffer, bytearray(test_data[:4]))
+        self.assertEqual(data.readRawDataInto(buffer), 1)
+        self.assertEqual(buffer[:1], bytearray(test_data[4:]))
+
     def testBytes(self):
         dataOne = QDataStream()
         self.assertEqual(dataOne.readBytes(4), None)
@@ -74,6 +74,23 @@ class TestQIODeviceBufferedRead(unittest.TestCase):
         self.assertEqual(bytes_read, bytes_read_again2)
         self.assertEqual(response_again2, response2)
 
+    def test_readinto(self) -> None:
+        response1 = bytearray(1024)
+        bytes_read = self.buffer.readinto(response1)
+        self.assertEqual(bytes_read, len(self.text))
+        self.assertEqual(response1[:bytes_read].decode("utf-8"), self.text)
+
+        # Read into a slice of a larger buffer through a memoryview
+        self.buffer.seek(0)
+        response2 = bytearray(32)
+        bytes_read = self.buffer.readinto(memoryview(response2)[4:], 6)
+        self.assertEqual(bytes_read, 6)
+        self.assertEqual(response2[4:10].decode("utf-8"), self.text[:6])
+        self.assertEqual(response2[:4], bytearray(4))
+
+        # Read-only buffers are rejected
+        self.assertRaises(TypeError, self.buffer.readinto, b"immutable")
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,109 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+'''Test cases for binary data returned by Python implementations of QIODevice.readData()'''
+
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QByteArray, QIODevice
+
+DATA = b'binary\x00data\xff\x00with zeros'
+
+
+class BytesDevice(QIODevice):
+    '''Returns the data from readData() using the type passed in.'''
+    def __init__(self, data_type):
+        super().__init__()
+        self._data = DATA
+        self._pos = 0
+        self._data_type = data_type
+
+    def isSequential(self):
+        return True
+
+    def bytesAvailable(self):
+        return len(self._data) - self._pos + super().bytesAvailable()
+
+    def readData(self, maxlen):
+        chunk = self._data[self._pos:self._pos + maxlen]
+        self._pos += len(chunk)
+        return self._data_type(chunk)
+
+
+class IntoDevice(BytesDevice):
+    '''Writes directly into the buffer passed to readDataInto().'''
+    def __init__(self):
+        super().__init__(bytes)
+        self.into_calls = 0
+
+    def readDataInto(self, buffer):
+        self.into_calls += 1
+        size = min(len(buffer), len(self._data) - self._pos)
+        buffer[:size] = self._data[self._pos:self._pos + size]
+        self._pos += size
+        return size
+
+
+class IntoOnlyDevice(QIODevice):
+    '''Implements only readDataInto(), leaving readData() unimplemented.'''
+    def __init__(self):
+        super().__init__()
+        self._pos = 0
+
+    def isSequential(self):
+        return True
+
+    def bytesAvailable(self):
+        return len(DATA) - self._pos + super().bytesAvailable()
+
+    def readDataInto(self, buffer):
+        size = min(len(buffer), len(DATA) - self._pos)
+        buffer[:size] = DATA[self._pos:self._pos + size]
+        self._pos += size
+        return size
+
+
+class KeepingDevice(IntoOnlyDevice):
+    '''Keeps a view on the destination buffer beyond the call.'''
+    def readDataInto(self, buffer):
+        self.kept = buffer[:1]
+        return super().readDataInto(buffer)
+
+
+class TestReadData(unittest.TestCase):
+    def _readAll(self, device):
+        self.assertTrue(device.open(QIODevice.OpenModeFlag.ReadOnly))
+        result = device.readAll()
+        device.close()
+        return result.data()
+
+    def testBinarySafe(self):
+        for data_type in (bytes, bytearray, QByteArray, memoryview):
+            self.assertEqual(self._readAll(BytesDevice(data_type)), DATA)
+
+    def testReadDataInto(self):
+        device = IntoDevice()
+        self.assertEqual(self._readAll(device), DATA)
+        self.assertGreater(device.into_calls, 0)
+
+    def testReadDataIntoOnly(self):
+        self.assertEqual(self._readAll(IntoOnlyDevice()), DATA)
+
+    def testKeepingViewRaises(self):
+        device = KeepingDevice()
+        self.assertTrue(device.open(QIODevice.OpenModeFlag.ReadOnly))
+        with self.assertRaises(BufferError):
+            device.read(4)
+        device.close()
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,86 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+'''Test cases for QThreadPool.map()'''
+
+import os
+import sys
+import threading
+import unittest
+
+from concurrent.futures import CancelledError
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QThreadPool
+
+
+class QThreadPoolMapTest(unittest.TestCase):
+    def setUp(self):
+        self.pool = QThreadPool()
+        self.pool.setMaxThreadCount(4)
+
+    def tearDown(self):
+        self.assertTrue(self.pool.waitForDone())
+        del self.pool
+
+    def testResultsInOrder(self):
+        threads = set()
+
+        def square(value):
+            threads.add(threading.get_ident())
+            return value * value
+
+        future = self.pool.map(square, range(1000))
+        self.assertEqual(future.result(timeout=10), [i * i for i in range(1000)])
+        self.assertNotIn(threading.get_ident(), threads)
+
+    def testEmpty(self):
+        future = self.pool.map(abs, [])
+        self.assertTrue(future.done())
+        self.assertEqual(future.result(), [])
+
+    def testException(self):
+        def check(value):
+            if value == 10:
+                raise ValueError("ten")
+            return value
+
+        future = self.pool.map(check, range(20))
+        with self.assertRaises(ValueError):
+            future.result(timeout=10)
+
+    def testNotCancellable(self):
+        future = self.pool.map(abs, range(100))
+        self.assertFalse(future.cancel())
+        self.assertEqual(future.result(timeout=10), list(range(100)))
+
+    def testCleared(self):
+        # Runnables removed from the queue complete the future.
+        self.pool.setMaxThreadCount(1)
+        started = threading.Event()
+        release = threading.Event()
+
+        def block():
+            started.set()
+            release.wait(10)
+
+        self.pool.start(block)
+        self.assertTrue(started.wait(10))
+        future = self.pool.map(abs, range(100))
+        self.pool.clear()
+        release.set()
+        with self.assertRaises(CancelledError):
+            future.result(timeout=10)
+
+    def testInvalidIterable(self):
+        with self.assertRaises(TypeError):
+            self.pool.map(abs, 42)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -9,6 +9,7 @@ import gc
 import os
 import sys
 import unittest
+import weakref
 
 from pathlib import Path
 sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
@@ -17,6 +18,7 @@ init_test_paths(False)
 
 from PySide6.QtCore import QObject, QThread, QTimer, Signal, Slot, SLOT
 from helper.usesqapplication import UsesQApplication
+from shiboken6 import Shiboken
 
 
 class WatchDog(QObject):
@@ -152,6 +154,36 @@ class TestSingleShotCallableObject(UsesQApplication):
         self.app.exec()
         self.assertTrue(callback.called)
 
+    def testSingleShotWithCallableInDeletedObject(self):
+        '''The object of a method is the context, the call is dropped
+           when it is deleted.'''
+        callback = self.CallbackObject(self.app)
+        callback.called = False
+        QTimer.singleShot(10, callback.func)
+        Shiboken.delete(callback)
+        QTimer.singleShot(100, self.app.quit)
+        self.app.exec()
+        self.assertFalse(callback.called)
+
+    def testSingleShotWithMethodOfReleasedObject(self):
+        '''The timer does not keep the object of a method alive, the call
+           is skipped when it is garbage collected.'''
+        calls = []
+
+        class Callback:
+            def func(self):
+                calls.append(1)
+
+        callback = Callback()
+        callback_ref = weakref.ref(callback)
+        QTimer.singleShot(10, callback.func)
+        del callback
+        gc.collect()
+        self.assertIsNone(callback_ref())
+        QTimer.singleShot(100, self.app.quit)
+        self.app.exec()
+        self.assertFalse(calls)
+
 
 class SigEmitter(QObject):
 
@@ -191,6 +223,17 @@ class TestSingleShotSignal(UsesQApplication):
         self.app.exec()
         self.assertTrue(self.called)
 
+    def testSingleShotSignalOfDeletedObject(self):
+        '''The object owning the signal is the context, the emission is
+           dropped when it is deleted.'''
+        emitter = SigEmitter()
+        emitter.sig1.connect(self.callback)
+        QTimer.singleShot(10, emitter.sig1)
+        Shiboken.delete(emitter)
+        QTimer.singleShot(100, self.app.quit)
+        self.app.exec()
+        self.assertFalse(self.called)
+
 
 if __name__ == '__main__':
     unittest.main()
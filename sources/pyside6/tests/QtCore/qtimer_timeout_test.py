@@ -68,6 +68,34 @@ class TestTimeoutSignal(UsesQApplication):
         self.assertTrue(self.called)
         self.assertEqual(sys.getrefcount(self.timer), refCount)
 
+    def testCallOnTimeout(self):
+        '''callOnTimeout() calls the callable on each timeout.'''
+        timeouts = []
+
+        def count():
+            timeouts.append(True)
+            if len(timeouts) == 3:
+                self.timer.stop()
+                self.app.quit()
+
+        connection = self.timer.callOnTimeout(count)
+        self.timer.start(4)
+        self.app.exec()
+        self.assertEqual(len(timeouts), 3)
+        self.assertTrue(QObject.disconnect(connection))
+
+    def testCallOnTimeoutContext(self):
+        '''The call is dropped when the context object is deleted.'''
+        context = QObject()
+        self.timer.callOnTimeout(context, self.callback)
+        del context
+        # PYSIDE-535: Need to collect garbage in PyPy to trigger deletion
+        gc.collect()
+        self.timer.start(4)
+        self.watchdog.startTimer(10)
+        self.app.exec()
+        self.assertFalse(self.called)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,104 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+'''Test the result types of QHttpServer route handlers against a loopback
+server.'''
+
+import asyncio
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QUrl
+from PySide6.QtNetwork import (QHostAddress, QNetworkAccessManager, QNetworkRequest,
+                               QTcpServer)
+from PySide6.QtHttpServer import QHttpServer, QHttpServerResponder, QHttpServerResponse
+import PySide6.QtAsyncio as QtAsyncio
+
+
+BINARY = bytes(range(256)) * 16
+
+
+async def fetch(manager, url):
+    future = asyncio.get_running_loop().create_future()
+    reply = manager.get(QNetworkRequest(url))
+    reply.finished.connect(lambda: future.set_result(None))
+    await future
+    status = reply.attribute(QNetworkRequest.Attribute.HttpStatusCodeAttribute)
+    content_type = reply.header(QNetworkRequest.KnownHeaders.ContentTypeHeader)
+    return status, content_type, reply.readAll().data()
+
+
+class QHttpServerRouteTest(unittest.TestCase):
+
+    def setUp(self):
+        self.server = QHttpServer()
+        self.server.route("/text", lambda request: "Hello")
+        self.server.route("/bytes", lambda request: BINARY)
+        self.server.route("/response", lambda request: QHttpServerResponse(
+            b"application/json", b'{"key": 1}', QHttpServerResponder.StatusCode.Created))
+        self.server.route("/status", lambda request: QHttpServerResponder.StatusCode.NotFound)
+        self.server.route("/error", lambda request: 1 / 0)
+
+        async def delayed(request):
+            path = request.url().path()
+            await asyncio.sleep(0.01)
+            return path.encode()
+
+        self.server.route("/async", delayed)
+
+        async def delayed_request(request):
+            await asyncio.sleep(0.01)
+            # The request outlives the synchronous part of the handler.
+            return f"{request.url().path()}?{request.query().toString()}"
+
+        self.server.route("/async-request", delayed_request)
+
+        self.tcp_server = QTcpServer()
+        self.assertTrue(self.tcp_server.listen(QHostAddress.SpecialAddress.LocalHost))
+        self.assertTrue(self.server.bind(self.tcp_server))
+        self.base_url = f"http://127.0.0.1:{self.tcp_server.serverPort()}"
+
+    def run_requests(self, *paths):
+        async def main():
+            manager = QNetworkAccessManager()
+            requests = [fetch(manager, QUrl(self.base_url + path)) for path in paths]
+            return await asyncio.gather(*requests)
+
+        return QtAsyncio.run(main(), keep_running=False, quit_qapp=False)
+
+    def test_synchronous_handlers(self):
+        text, binary, response, status = self.run_requests("/text", "/bytes",
+                                                           "/response", "/status")
+        self.assertEqual(text[0], 200)
+        self.assertEqual(text[2], b"Hello")
+        self.assertEqual(binary[0], 200)
+        self.assertEqual(binary[2], BINARY)
+        self.assertEqual(response, (201, "application/json", b'{"key": 1}'))
+        self.assertEqual(status[0], 404)
+
+    def test_error(self):
+        (error,) = self.run_requests("/error")
+        self.assertEqual(error[0], 500)
+
+    def test_asynchronous_handler(self):
+        # Slow handlers do not block other requests.
+        delayed, text = self.run_requests("/async", "/text")
+        self.assertEqual(delayed[0], 200)
+        self.assertEqual(delayed[2], b"/async")
+        self.assertEqual(text[2], b"Hello")
+
+    def test_request_after_await(self):
+        (delayed,) = self.run_requests("/async-request?key=value")
+        self.assertEqual(delayed[0], 200)
+        self.assertEqual(delayed[2], b"/async-request?key=value")
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -61,6 +61,22 @@ class HttpSignalsCase(unittest.TestCase):
 
         self.assertTrue(self.called)
 
+    def callbackInto(self):
+        buffer = bytearray(64)
+        while self.server.hasPendingDatagrams():
+            size, host, port = self.server.readDatagramInto(buffer)
+            self.assertEqual(bytes(buffer[:size]), b'datagram')
+            self.assertTrue(host.isLoopback())
+            self.called = True
+            self.app.quit()
+
+    def testReadDatagramInto(self):
+        self.server.readyRead.connect(self.callbackInto)
+        self.sendPackage()
+        self.app.exec()
+
+        self.assertTrue(self.called)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,114 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths  # noqa: E402
+init_test_paths(False)
+
+from helper.usesqapplication import UsesQApplication  # noqa: E402, F401
+
+from PySide6.QtCore import QObject, QUrl, Property, Signal, qInstallMessageHandler  # noqa: E402
+from PySide6.QtQml import ListProperty, QmlElement  # noqa: E402
+from PySide6.QtQuick import QQuickView  # noqa: E402
+
+
+QML_IMPORT_NAME = "test.NativeListPropertyTest"
+QML_IMPORT_MAJOR_VERSION = 1
+
+output_messages = []
+
+
+def message_handler(mode, context, message):
+    global output_messages
+    output_messages.append(f"{message}")
+
+
+def dummyFunc():
+    pass
+
+
+@QmlElement
+class Member(QObject):
+    def __init__(self, parent=None):
+        super().__init__(parent)
+        self._name = ''
+
+    @Property(str, final=True)
+    def name(self):
+        return self._name
+
+    @name.setter
+    def name(self, value):
+        self._name = value
+
+
+@QmlElement
+class Group(QObject):
+    membersChanged = Signal()
+
+    def __init__(self, parent=None):
+        super().__init__(parent)
+        self.notifications = 0
+        self.membersChanged.connect(self._count_notification)
+
+    def _count_notification(self):
+        self.notifications += 1
+
+    members = ListProperty(Member, native=True, notify=membersChanged)
+
+
+class TestNativeListProperty(UsesQApplication):
+    def testCallbacksRejected(self):
+        with self.assertRaises(TypeError):
+            ListProperty(QObject, append=dummyFunc, native=True)
+
+    def testPythonAccess(self):
+        group = Group()
+        self.assertEqual(group.members, [])
+        members = [Member() for _ in range(3)]
+        group.members = members
+        self.assertEqual(group.notifications, 1)
+        self.assertEqual(group.members, members)
+
+        group.members = (members[2], members[0])
+        self.assertEqual(group.notifications, 2)
+        self.assertEqual(group.members, [members[2], members[0]])
+
+        # The list keeps its items alive
+        del members
+        self.assertEqual(len(group.members), 2)
+
+        with self.assertRaises(TypeError):
+            group.members = [QObject()]
+        with self.assertRaises(TypeError):
+            group.members = 42
+        self.assertEqual(len(group.members), 2)
+        self.assertEqual(group.notifications, 2)
+
+    def testQmlAccess(self):
+        global output_messages
+        qInstallMessageHandler(message_handler)
+        view = QQuickView()
+        file = Path(__file__).resolve().parent / 'listproperty_native.qml'
+        self.assertTrue(file.is_file())
+        view.setSource(QUrl.fromLocalFile(file))
+        view.show()
+        qInstallMessageHandler(None)
+        self.assertEqual(output_messages[0], "List length: 3")
+        self.assertEqual(output_messages[1], "First element: Alice")
+        self.assertEqual(output_messages[2], "Removing last item: Charlie")
+        self.assertEqual(output_messages[3], "Replaced last item: David")
+
+        # Modifications done by QML are visible from Python
+        group = view.rootObject().findChild(Group, "group")
+        self.assertEqual([m.name for m in group.members], ["Alice", "David"])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,39 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR BSD-3-Clause
+
+import QtQuick 2.0
+import test.NativeListPropertyTest
+
+Rectangle {
+    width: 360
+    height: 360
+
+    Group {
+        id: group
+        objectName: "group"
+        members: [
+            Member {
+                name: "Alice"
+            },
+            Member {
+                name: "Bob"
+            },
+            Member {
+                name: "Charlie"
+            }
+        ]
+    }
+
+    Member {
+        id: david
+        name: "David"
+    }
+
+    Component.onCompleted: {
+        console.log("List length: " + group.members.length);
+        console.log("First element: " + group.members[0].name);
+        console.log("Removing last item: " + group.members.pop().name);
+        group.members[group.members.length - 1] = david;
+        console.log("Replaced last item: " + group.members[group.members.length - 1].name);
+    }
+}
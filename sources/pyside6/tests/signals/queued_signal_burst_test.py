@@ -0,0 +1,92 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+'''Test the delivery of bursts of queued signals to Python slots, which
+keeps the GIL across consecutive deliveries to Python, interleaved with
+deliveries to a C++ slot, which run with the GIL released.'''
+
+import os
+import sys
+import threading
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QCoreApplication, QObject, QThread, QTimer, Signal, Slot
+from helper.usesqapplication import UsesQApplication
+
+
+COUNT = 20000
+
+
+class Emitter(QThread):
+    value = Signal(int)
+
+    def run(self):
+        for i in range(COUNT):
+            self.value.emit(i)
+
+
+class Receiver(QObject):
+    def __init__(self, parent=None):
+        super().__init__(parent)
+        self.values = []
+
+    @Slot(int)
+    def receive(self, value):
+        self.values.append(value)
+        if value == COUNT // 2:
+            # Enter a nested event loop with the GIL released.
+            QCoreApplication.processEvents()
+
+
+class QueuedSignalBurstTest(UsesQApplication):
+
+    def testBurst(self):
+        receiver = Receiver()
+        emitter = Emitter()
+        emitter.value.connect(receiver.receive)
+        lambda_values = []
+        emitter.value.connect(lambda v: lambda_values.append(v))
+        cpp_receiver = QTimer()  # setInterval() is a C++ slot
+        emitter.value.connect(cpp_receiver.setInterval)
+
+        # A Python thread needing the GIL while the burst is delivered
+        ticks = []
+        stop = threading.Event()
+
+        def tick():
+            while not stop.is_set():
+                ticks.append(1)
+                stop.wait(0.001)
+
+        ticker = threading.Thread(target=tick)
+        ticker.start()
+
+        def check_done():
+            if (len(lambda_values) == COUNT and cpp_receiver.interval() == COUNT - 1
+                    and emitter.isFinished()):
+                self.app.quit()
+
+        timer = QTimer()
+        timer.timeout.connect(check_done)
+        timer.start(10)
+        QTimer.singleShot(20000, self.app.quit)
+        emitter.start()
+        self.app.exec()
+        emitter.wait()
+        stop.set()
+        ticker.join()
+
+        self.assertEqual(receiver.values, list(range(COUNT)))
+        self.assertEqual(lambda_values, list(range(COUNT)))
+        self.assertEqual(cpp_receiver.interval(), COUNT - 1)
+        self.assertTrue(ticks)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -82,14 +82,21 @@ QTextStream &operator<<(QTextStream &str, const RejectEntry &re)
 }
 
 static void applyCachedFunctionModifications(const AbstractMetaFunctionPtr &metaFunction,
-                                             const FunctionModificationList &functionMods)
+                                             const FunctionModificationList &functionMods,
+                                             const QString &className)
 {
+    auto allowThread = TypeSystem::AllowThread::Unspecified;
     for (const FunctionModification &mod : functionMods) {
         if (mod.exceptionHandling() != TypeSystem::ExceptionHandling::Unspecified)
             metaFunction->setExceptionHandlingModification(mod.exceptionHandling());
         if (mod.allowThread() != TypeSystem::AllowThread::Unspecified)
-            metaFunction->setAllowThreadModification(mod.allowThread());
+            allowThread = mod.allowThread();
     }
+    // modify-function takes precedence over <allow-thread-rule>
+    if (allowThread == TypeSystem::AllowThread::Unspecified)
+        allowThread = TypeDatabase::instance()->allowThreadRule(className, metaFunction->name());
+    if (allowThread != TypeSystem::AllowThread::Unspecified)
+        metaFunction->setAllowThreadModification(allowThread);
 }
 
 bool AbstractMetaBuilderPrivate::m_useGlobalHeader = false;
@@ -1750,7 +1757,9 @@ AbstractMetaFunctionPtr
 
     // Find the correct default values
     const FunctionModificationList functionMods = metaFunction->modifications(metaClass);
-    applyCachedFunctionModifications(metaFunction, functionMods);
+    applyCachedFunctionModifications(metaFunction, functionMods,
+                                     metaClass != nullptr
+                                     ? metaClass->typeEntry()->qualifiedCppName() : QString{});
     for (qsizetype i = 0; i < metaArguments.size(); ++i) {
         AbstractMetaArgument &metaArg = metaArguments[i];
 
@@ -2182,7 +2191,7 @@ AbstractMetaFunctionPtr
         ? AbstractMetaFunction::findClassModifications(metaFunction.get(), currentClass)
         : AbstractMetaFunction::findGlobalModifications(metaFunction.get());
 
-    applyCachedFunctionModifications(metaFunction, functionMods);
+    applyCachedFunctionModifications(metaFunction, functionMods, className);
 
     // Find the correct default values
     for (qsizetype i = 0, size = metaArguments.size(); i < size; ++i) {
@@ -3480,12 +3489,52 @@ static void writeRejectLogFile(const QString &name,
     }
 }
 
+// Report which functions of the generated classes release the GIL
+// (allow-thread) when calling into C++.
+static void writeAllowThreadLogFile(const QString &name, const AbstractMetaClassList &classes)
+{
+    QStringList released;
+    QStringList kept;
+    for (const auto &cls : classes) {
+        if (!cls->typeEntry()->generateCode())
+            continue;
+        for (const auto &func : cls->functions()) {
+            if (func->implementingClass() == cls && !func->isPrivate()
+                && !func->isDestructor() && !func->isModifiedRemoved()) {
+                const QString signature = cls->qualifiedCppName() + u"::"_s
+                                          + func->minimalSignature();
+                (func->allowThread() ? released : kept).append(signature);
+            }
+        }
+    }
+
+    QFile f(name);
+    if (!f.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        qCWarning(lcShiboken, "%s", qPrintable(msgCannotOpenForWriting(f)));
+        return;
+    }
+
+    QTextStream s(&f);
+    const std::pair<QByteArray, const QStringList *> sections[] = {
+        {"Releasing the GIL"_ba, &released},
+        {"Keeping the GIL"_ba, &kept}
+    };
+    for (const auto &section : sections) {
+        const QByteArray underline(section.first.size(), '*');
+        s << underline << '\n' << section.first << '\n' << underline << "\n\n";
+        for (const auto &signature : *section.second)
+            s << " - " << signature << '\n';
+        s << '\n';
+    }
+}
+
 void AbstractMetaBuilderPrivate::dumpLog() const
 {
     writeRejectLogFile(m_logDirectory + u"mjb_rejected_classes.log"_s, m_rejectedClasses);
     writeRejectLogFile(m_logDirectory + u"mjb_rejected_enums.log"_s, m_rejectedEnums);
     writeRejectLogFile(m_logDirectory + u"mjb_rejected_functions.log"_s, m_rejectedFunctions);
     writeRejectLogFile(m_logDirectory + u"mjb_rejected_fields.log"_s, m_rejectedFields);
+    writeAllowThreadLogFile(m_logDirectory + u"mjb_allow_thread.log"_s, m_metaClasses);
 }
 
 // Topological sorting of classes. Templates for use with
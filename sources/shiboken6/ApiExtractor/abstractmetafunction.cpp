@@ -26,21 +26,27 @@
 #include "qtcompat.h"
 
 #include <QtCore/QDebug>
+#include <QtCore/QReadWriteLock>
 #include <QtCore/QRegularExpression>
 
 #include <algorithm>
+#include <deque>
 
 using namespace Qt::StringLiterals;
 
 // Cache FunctionModificationList in a flat list per class (0 for global
 // functions, or typically owner/implementing/declaring class.
+// A std::deque is used since references to the entries are returned and
+// the classes may be generated in several threads.
 struct ModificationCacheEntry
 {
      AbstractMetaClassCPtr klass;
      FunctionModificationList modifications;
 };
 
-using ModificationCache = QList<ModificationCacheEntry>;
+using ModificationCache = std::deque<ModificationCacheEntry>;
+
+static QReadWriteLock modificationCacheLock;
 
 class AbstractMetaFunctionPrivate
 {
@@ -1090,16 +1096,24 @@ const FunctionModificationList &
 {
     if (m_addedFunction)
         return m_addedFunction->modifications();
-    for (const auto &ce : m_modificationCache) {
-        if (ce.klass == implementor)
-            return ce.modifications;
+    {
+        QReadLocker locker(&modificationCacheLock);
+        for (const auto &ce : m_modificationCache) {
+            if (ce.klass == implementor)
+                return ce.modifications;
+        }
     }
     auto modifications = m_class == nullptr
         ? AbstractMetaFunction::findGlobalModifications(q)
         : AbstractMetaFunction::findClassModifications(q, implementor);
 
-    m_modificationCache.append({implementor, modifications});
-    return m_modificationCache.constLast().modifications;
+    QWriteLocker locker(&modificationCacheLock);
+    for (const auto &ce : m_modificationCache) { // Inserted by another thread?
+        if (ce.klass == implementor)
+            return ce.modifications;
+    }
+    m_modificationCache.push_back({implementor, modifications});
+    return m_modificationCache.back().modifications;
 }
 
 const FunctionModificationList &
@@ -1112,6 +1126,7 @@ const FunctionModificationList &
 
 void AbstractMetaFunction::clearModificationsCache()
 {
+    QWriteLocker locker(&modificationCacheLock);
     d->m_modificationCache.clear();
 }
 
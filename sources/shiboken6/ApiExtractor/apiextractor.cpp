@@ -23,9 +23,11 @@
 #include "typedefentry.h"
 #include "namespacetypeentry.h"
 #include "typesystemtypeentry.h"
+#include "clangparser/clangparser.h"
 
 #include "qtcompat.h"
 
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QDir>
 #include <QtCore/QDebug>
 #include <QtCore/QTemporaryFile>
@@ -70,6 +72,14 @@ QList<OptionDescription> ApiExtractor::options()
          u"Option to be passed to clang"_s},
         {u"clang-options"_s,
          u"A comma-separated list of options to be passed to clang"_s},
+        {u"clang-cache-directory=<path>"_s,
+         u"Directory for caching the parsed headers. Reruns with unchanged\n"
+          "headers and options load the cached translation unit."_s},
+        {u"clang-pch=<file>"_s,
+         u"Precompiled header of a dependency module (see clang-pch-output)\n"
+          "to be used instead of parsing its headers again."_s},
+        {u"clang-pch-output=<file>"_s,
+         u"Save the parsed headers as precompiled header for dependent modules."_s},
         {u"skip-deprecated"_s,
          u"Skip deprecated functions"_s},
         {u"-F<path>"_s, {} },
@@ -179,6 +189,18 @@ bool ApiExtractorOptionsParser::handleOption(const QString &key, const QString &
         m_options->m_clangOptions.append(value.split(u',', Qt::SkipEmptyParts));
         return true;
     }
+    if (key == u"clang-cache-directory") {
+        clang::setParserCacheDirectory(QDir::cleanPath(value));
+        return true;
+    }
+    if (key == u"clang-pch") {
+        clang::setPrecompiledHeader(QDir::cleanPath(value));
+        return true;
+    }
+    if (key == u"clang-pch-output") {
+        clang::setPrecompiledHeaderOutput(QDir::cleanPath(value));
+        return true;
+    }
     if (key == u"include-paths") {
         parseIncludePathOption(value.split(QDir::listSeparator(), Qt::SkipEmptyParts),
                                HeaderType::Standard);
@@ -329,6 +351,22 @@ static void addPySideExtensions(QByteArrayList *a)
     a->append(QByteArrayLiteral("-DQSIMD_H"));
 }
 
+// Write the main file passed to clang unless it exists with the same contents,
+// which keeps its modification time for the validation of AST files.
+static bool writeStableSourceFile(const QString &fileName, const QByteArray &contents)
+{
+    QFile file(fileName);
+    if (file.open(QIODevice::ReadOnly) && file.readAll() == contents)
+        return true;
+    file.close();
+    if (!file.open(QIODevice::WriteOnly) || file.write(contents) != contents.size()) {
+        std::cerr << "could not create " << qPrintable(fileName)
+            << ": " << qPrintable(file.errorString()) << '\n';
+        return false;
+    }
+    return true;
+}
+
 bool ApiExtractorPrivate::runHelper(ApiExtractorFlags flags)
 {
     if (m_builder)
@@ -343,19 +381,41 @@ bool ApiExtractorPrivate::runHelper(ApiExtractorFlags flags)
         + m_cppFileNames.constFirst().baseName() + "_XXXXXX.hpp"_L1;
     QTemporaryFile ppFile(pattern);
     bool autoRemove = !qEnvironmentVariableIsSet("KEEP_TEMP_FILES");
-    // make sure that a tempfile can be written
-    if (!ppFile.open()) {
-        std::cerr << "could not create tempfile " << qPrintable(pattern)
-            << ": " << qPrintable(ppFile.errorString()) << '\n';
-        return false;
-    }
-    for (const auto &cppFileName : std::as_const(m_cppFileNames)) {
-        ppFile.write("#include \"");
-        ppFile.write(cppFileName.absoluteFilePath().toLocal8Bit());
-        ppFile.write("\"\n");
+    QByteArray includes;
+    for (const auto &cppFileName : std::as_const(m_cppFileNames))
+        includes += "#include \"" + cppFileName.absoluteFilePath().toLocal8Bit() + "\"\n";
+
+    QString preprocessedCppFileName;
+    const QString &pchOutput = clang::precompiledHeaderOutput();
+    const QString &cacheDirectory = clang::parserCacheDirectory();
+    if (!pchOutput.isEmpty()) {
+        // A precompiled header is validated against its source file when
+        // dependent modules use it, so keep it next to the output (and
+        // unmodified if possible).
+        preprocessedCppFileName = pchOutput + u".hpp"_s;
+        if (!writeStableSourceFile(preprocessedCppFileName, includes))
+            return false;
+    } else if (!cacheDirectory.isEmpty()) {
+        // The cached translation unit is keyed on the clang arguments
+        // including the main file, so name the file after its contents.
+        const QByteArray hash = QCryptographicHash::hash(includes, QCryptographicHash::Sha1);
+        preprocessedCppFileName = cacheDirectory + u'/'
+                                  + QLatin1StringView(hash.toHex()) + u".hpp"_s;
+        if (!QDir().mkpath(cacheDirectory)
+            || !writeStableSourceFile(preprocessedCppFileName, includes)) {
+            return false;
+        }
+    } else {
+        // make sure that a tempfile can be written
+        if (!ppFile.open()) {
+            std::cerr << "could not create tempfile " << qPrintable(pattern)
+                << ": " << qPrintable(ppFile.errorString()) << '\n';
+            return false;
+        }
+        ppFile.write(includes);
+        preprocessedCppFileName = ppFile.fileName();
+        ppFile.close();
     }
-    const QString preprocessedCppFileName = ppFile.fileName();
-    ppFile.close();
     m_builder = new AbstractMetaBuilder;
     m_builder->setLogDirectory(m_logDirectory);
     m_builder->setGlobalHeaders(m_cppFileNames);
@@ -437,6 +497,17 @@ QStringList ApiExtractor::clangOptions() const
     return d->m_clangOptions;
 }
 
+QStringList ApiExtractor::inputFiles() const
+{
+    QStringList result = clang::includedFiles();
+    result += TypeDatabase::instance()->inputFiles();
+    for (const auto &cppFileName : std::as_const(d->m_cppFileNames))
+        result.append(cppFileName.absoluteFilePath());
+    result.sort();
+    result.removeDuplicates();
+    return result;
+}
+
 AbstractMetaFunctionPtr
     ApiExtractor::inheritTemplateFunction(const AbstractMetaFunctionCPtr &function,
                                           const AbstractMetaTypeList &templateTypes)
@@ -49,6 +49,8 @@ public:
     void setLogDirectory(const QString& logDir);
     LanguageLevel languageLevel() const;
     QStringList clangOptions() const;
+    /// Files read by the last run (headers, typesystem files, code snippets)
+    QStringList inputFiles() const;
 
     const AbstractMetaEnumList &globalEnums() const;
     const AbstractMetaFunctionCList &globalFunctions() const;
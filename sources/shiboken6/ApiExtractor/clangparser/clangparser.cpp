@@ -7,12 +7,19 @@
 #include "compilersupport.h"
 
 #include <QtCore/QByteArrayList>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
 #include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
 #include <QtCore/QScopedArrayPointer>
+#include <QtCore/QSet>
 #include <QtCore/QString>
 
+#include <optional>
+
 using namespace Qt::StringLiterals;
 
 namespace clang {
@@ -232,6 +239,262 @@ static QByteArray msgCreateTranslationUnit(const QByteArrayList &clangArgs, unsi
     return result;
 }
 
+static QString _parserCacheDirectory;
+
+const QString &parserCacheDirectory()
+{
+    return _parserCacheDirectory;
+}
+
+void setParserCacheDirectory(const QString &d)
+{
+    _parserCacheDirectory = d;
+}
+
+static QString _precompiledHeader;
+
+const QString &precompiledHeader()
+{
+    return _precompiledHeader;
+}
+
+void setPrecompiledHeader(const QString &h)
+{
+    _precompiledHeader = h;
+}
+
+static QString _precompiledHeaderOutput;
+
+const QString &precompiledHeaderOutput()
+{
+    return _precompiledHeaderOutput;
+}
+
+void setPrecompiledHeaderOutput(const QString &h)
+{
+    _precompiledHeaderOutput = h;
+}
+
+// Save a translation unit via a temporary file so that readers never see
+// a partially written file.
+static bool saveTranslationUnit(CXTranslationUnit tu, const QString &fileName)
+{
+    const QString tempFileName = fileName + u".tmp"_s;
+    const int err = clang_saveTranslationUnit(tu, QFile::encodeName(tempFileName).constData(),
+                                              clang_defaultSaveOptions(tu));
+    if (err != CXSaveError_None) {
+        qWarning().noquote().nospace() << "Could not save "
+            << QDir::toNativeSeparators(tempFileName) << ", error code: " << err;
+        QFile::remove(tempFileName);
+        return false;
+    }
+    QFile::remove(fileName);
+    if (!QFile::rename(tempFileName, fileName)) {
+        qWarning().noquote().nospace() << "Could not rename "
+            << QDir::toNativeSeparators(tempFileName) << " to "
+            << QDir::toNativeSeparators(fileName);
+        QFile::remove(tempFileName);
+        return false;
+    }
+    return true;
+}
+
+// Cache of translation units saved as AST files to skip parsing unchanged
+// headers. The file name is a hash of the versions and the arguments; a
+// dependency file lists the hashes of the contents of all included files,
+// which are checked before loading the unit. The main file passed by
+// ApiExtractor is named after its contents, so identical runs share the key.
+// Loading a unit touches its dependency file; entries which have not been
+// used for parserCacheMaxAgeDays are removed when saving a new one.
+class TranslationUnitCache
+{
+public:
+    explicit TranslationUnitCache(const QByteArrayList &clangArgs, unsigned flags);
+
+    CXTranslationUnit load(CXIndex index) const;
+    void save(CXTranslationUnit tu) const;
+
+private:
+    QString m_astFileName;
+    QString m_dependencyFileName;
+};
+
+static constexpr int parserCacheMaxAgeDays = 30;
+
+static QByteArray fileContentHash(const QString &fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return {};
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(&file);
+    return hash.result().toHex();
+}
+
+struct Dependency
+{
+    QByteArray hash;
+    QString fileName;
+};
+
+// Read a dependency file consisting of lines of "<hash> <file>"
+static std::optional<QList<Dependency>> readDependencyFile(const QString &fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return std::nullopt;
+    QList<Dependency> result;
+    while (!file.atEnd()) {
+        const QByteArray line = file.readLine().trimmed();
+        const auto spacePos = line.indexOf(' ');
+        if (spacePos <= 0)
+            return std::nullopt;
+        result.append({line.first(spacePos), QFile::decodeName(line.sliced(spacePos + 1))});
+    }
+    return result;
+}
+
+// Remove the entries which have not been used recently along with main files
+// and left-over temporary files no longer referenced by a dependency file.
+static void pruneParserCache()
+{
+    const QDir cacheDir(parserCacheDirectory());
+    const QDateTime limit = QDateTime::currentDateTime().addDays(-parserCacheMaxAgeDays);
+    QSet<QString> usedFiles;
+    const auto dependencyFiles = cacheDir.entryInfoList({u"*.dep"_s}, QDir::Files);
+    for (const QFileInfo &dependencyFile : dependencyFiles) {
+        const QString baseName = dependencyFile.absolutePath() + u'/'
+                                 + dependencyFile.completeBaseName();
+        if (dependencyFile.lastModified() < limit) {
+            QFile::remove(dependencyFile.absoluteFilePath());
+            QFile::remove(baseName + u".ast"_s);
+        } else {
+            usedFiles.insert(baseName + u".ast"_s);
+            if (const auto dependencies = readDependencyFile(dependencyFile.absoluteFilePath())) {
+                for (const auto &dependency : dependencies.value())
+                    usedFiles.insert(QFileInfo(dependency.fileName).absoluteFilePath());
+            }
+        }
+    }
+
+    const auto files = cacheDir.entryInfoList({u"*.ast"_s, u"*.hpp"_s, u"*.tmp"_s},
+                                              QDir::Files);
+    for (const QFileInfo &file : files) {
+        if (file.lastModified() < limit && !usedFiles.contains(file.absoluteFilePath()))
+            QFile::remove(file.absoluteFilePath());
+    }
+}
+
+TranslationUnitCache::TranslationUnitCache(const QByteArrayList &clangArgs, unsigned flags)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QByteArrayLiteral(SHIBOKEN_VERSION));
+    const CXString clangVersion = clang_getClangVersion();
+    hash.addData(QByteArray(clang_getCString(clangVersion)));
+    clang_disposeString(clangVersion);
+    hash.addData(QByteArray::number(flags));
+    for (const QByteArray &arg : clangArgs)
+        hash.addData(arg + '\0');
+
+    const QString baseName = parserCacheDirectory() + u'/'
+                             + QLatin1StringView(hash.result().toHex());
+    m_astFileName = baseName + u".ast"_s;
+    m_dependencyFileName = baseName + u".dep"_s;
+}
+
+CXTranslationUnit TranslationUnitCache::load(CXIndex index) const
+{
+    if (!QFile::exists(m_astFileName))
+        return nullptr;
+    const auto dependencies = readDependencyFile(m_dependencyFileName);
+    if (!dependencies.has_value())
+        return nullptr;
+    for (const auto &dependency : dependencies.value()) {
+        if (fileContentHash(dependency.fileName) != dependency.hash)
+            return nullptr;
+    }
+
+    qDebug().noquote().nospace() << "clang_createTranslationUnit2("
+        << QDir::toNativeSeparators(m_astFileName) << ')';
+    CXTranslationUnit tu{};
+    const CXErrorCode err =
+        clang_createTranslationUnit2(index, QFile::encodeName(m_astFileName).constData(), &tu);
+    if (err || !tu) {
+        qWarning().noquote().nospace() << "Could not load "
+            << QDir::toNativeSeparators(m_astFileName) << ", error code: " << err;
+        return nullptr;
+    }
+
+    QFile dependencyFile(m_dependencyFileName); // Mark the entry as used
+    if (dependencyFile.open(QIODevice::ReadWrite))
+        dependencyFile.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+    return tu;
+}
+
+static void collectInclusion(CXFile includedFile, CXSourceLocation *, unsigned,
+                             CXClientData clientData)
+{
+    auto *fileNames = reinterpret_cast<QSet<QString> *>(clientData);
+    fileNames->insert(getFileName(includedFile));
+}
+
+void TranslationUnitCache::save(CXTranslationUnit tu) const
+{
+    QSet<QString> fileNames;
+    clang_getInclusions(tu, collectInclusion, &fileNames);
+    if (!precompiledHeader().isEmpty() && QFile::exists(precompiledHeader()))
+        fileNames.insert(precompiledHeader());
+    QStringList sortedFileNames(fileNames.cbegin(), fileNames.cend());
+    sortedFileNames.sort();
+
+    QByteArray dependencies;
+    for (const auto &fileName : std::as_const(sortedFileNames)) {
+        const QByteArray hash = fileContentHash(fileName);
+        if (fileName.isEmpty() || hash.isEmpty())
+            return;
+        dependencies += hash + ' ' + QFile::encodeName(fileName) + '\n';
+    }
+
+    if (!QDir().mkpath(parserCacheDirectory())) {
+        qWarning().noquote().nospace() << "Could not create the parser cache directory "
+            << QDir::toNativeSeparators(parserCacheDirectory());
+        return;
+    }
+
+    // Invalidate the old entry before writing the unit
+    QFile::remove(m_dependencyFileName);
+    if (!saveTranslationUnit(tu, m_astFileName))
+        return;
+
+    QSaveFile dependencyFile(m_dependencyFileName);
+    if (!dependencyFile.open(QIODevice::WriteOnly)
+        || dependencyFile.write(dependencies) != dependencies.size()
+        || !dependencyFile.commit()) {
+        qWarning().noquote().nospace() << "Could not write "
+            << QDir::toNativeSeparators(m_dependencyFileName);
+    }
+    pruneParserCache();
+}
+
+static CXTranslationUnit parseTranslationUnit(CXIndex index,
+                                              const QByteArrayList &clangArgs,
+                                              unsigned flags)
+{
+    QScopedArrayPointer<const char *> argv(byteArrayListToFlatArgV(clangArgs));
+    qDebug().noquote().nospace() << msgCreateTranslationUnit(clangArgs, flags);
+
+    CXTranslationUnit tu{};
+    CXErrorCode err = clang_parseTranslationUnit2(index, nullptr, argv.data(),
+                                                  clangArgs.size(), nullptr, 0,
+                                                  flags, &tu);
+    if (err || !tu) {
+        qWarning().noquote().nospace() << "Could not parse "
+            << clangArgs.constLast().constData() << ", error code: " << err;
+        return nullptr;
+    }
+    return tu;
+}
+
 static CXTranslationUnit createTranslationUnit(CXIndex index,
                                                const QByteArrayList &args,
                                                bool addCompilerSupportArguments,
@@ -261,21 +524,57 @@ static CXTranslationUnit createTranslationUnit(CXIndex index,
     }
     clangArgs += detectVulkan();
     clangArgs += args;
-    QScopedArrayPointer<const char *> argv(byteArrayListToFlatArgV(clangArgs));
-    qDebug().noquote().nospace() << msgCreateTranslationUnit(clangArgs, flags);
 
-    CXTranslationUnit tu{};
-    CXErrorCode err = clang_parseTranslationUnit2(index, nullptr, argv.data(),
-                                                  clangArgs.size(), nullptr, 0,
-                                                  defaultFlags | flags, &tu);
-    if (err || !tu) {
-        qWarning().noquote().nospace() << "Could not parse "
-            << clangArgs.constLast().constData() << ", error code: " << err;
-        return nullptr;
+    const bool usePrecompiledHeader = !precompiledHeader().isEmpty()
+                                      && QFile::exists(precompiledHeader());
+    if (usePrecompiledHeader) {
+        // Insert before the source file, which is expected to be the last argument
+        const auto sourcePos = clangArgs.size() - 1;
+        clangArgs.insert(sourcePos, QFile::encodeName(precompiledHeader()));
+        clangArgs.insert(sourcePos, "-include-pch"_ba);
+    }
+
+    std::optional<TranslationUnitCache> cache;
+    if (!parserCacheDirectory().isEmpty()) {
+        cache.emplace(clangArgs, defaultFlags | flags);
+        if (auto *tu = cache->load(index)) {
+            if (!precompiledHeaderOutput().isEmpty())
+                saveTranslationUnit(tu, precompiledHeaderOutput());
+            return tu;
+        }
+    }
+
+    CXTranslationUnit tu = parseTranslationUnit(index, clangArgs, defaultFlags | flags);
+    bool hasErrors = tu != nullptr && maxSeverity(getDiagnostics(tu)) >= CXDiagnostic_Error;
+    if ((tu == nullptr || hasErrors) && usePrecompiledHeader) {
+        // Stale or incompatible precompiled header of a dependency: fall back to
+        // parsing all headers.
+        qWarning().noquote().nospace() << "Parsing with the precompiled header "
+            << QDir::toNativeSeparators(precompiledHeader()) << " failed, retrying without it.";
+        if (tu != nullptr)
+            clang_disposeTranslationUnit(tu);
+        const auto pchPos = clangArgs.indexOf("-include-pch"_ba);
+        clangArgs.remove(pchPos, 2);
+        tu = parseTranslationUnit(index, clangArgs, defaultFlags | flags);
+        hasErrors = tu != nullptr && maxSeverity(getDiagnostics(tu)) >= CXDiagnostic_Error;
     }
+    if (tu == nullptr || hasErrors)
+        return tu;
+
+    if (cache.has_value())
+        cache->save(tu);
+    if (!precompiledHeaderOutput().isEmpty())
+        saveTranslationUnit(tu, precompiledHeaderOutput());
     return tu;
 }
 
+static QStringList _includedFiles;
+
+const QStringList &includedFiles()
+{
+    return _includedFiles;
+}
+
 /* clangFlags are flags to clang_parseTranslationUnit2() such as
  * CXTranslationUnit_KeepGoing (from CINDEX_VERSION_MAJOR/CINDEX_VERSION_MINOR 0.35)
  */
@@ -296,6 +595,15 @@ bool parse(const QByteArrayList  &clangArgs, bool addCompilerSupportArguments,
     if (!translationUnit)
         return false;
 
+    QSet<QString> fileNames;
+    clang_getInclusions(translationUnit, collectInclusion, &fileNames);
+    if (!precompiledHeader().isEmpty() && QFile::exists(precompiledHeader()))
+        fileNames.insert(precompiledHeader());
+    fileNames.remove(QString{});
+    fileNames.remove(QFile::decodeName(clangArgs.constLast())); // Temporary main file
+    _includedFiles = QStringList(fileNames.cbegin(), fileNames.cend());
+    _includedFiles.sort();
+
     CXCursor rootCursor = clang_getTranslationUnitCursor(translationUnit);
 
     clang_visitChildren(rootCursor, visitorCallback, reinterpret_cast<CXClientData>(&bv));
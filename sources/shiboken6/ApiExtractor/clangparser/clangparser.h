@@ -10,6 +10,7 @@
 #include <QtCore/QHash>
 #include <QtCore/QString>
 #include <QtCore/QList>
+#include <QtCore/QStringList>
 
 #include <string_view>
 #include <utility>
@@ -83,6 +84,22 @@ bool parse(const QByteArrayList  &clangArgs,
            bool addCompilerSupportArguments,
            LanguageLevel level, unsigned clangFlags, BaseVisitor &ctx);
 
+// Directory for caching the parsed translation units, empty: disabled
+const QString &parserCacheDirectory();
+void setParserCacheDirectory(const QString &d);
+
+// Files included by the last parsed translation unit (sorted)
+const QStringList &includedFiles();
+
+// Precompiled header of a dependency module to be included, empty: none
+const QString &precompiledHeader();
+void setPrecompiledHeader(const QString &h);
+
+// File to save the parsed translation unit to for use as precompiled
+// header by dependent modules, empty: none
+const QString &precompiledHeaderOutput();
+void setPrecompiledHeaderOutput(const QString &h);
+
 } // namespace clang
 
 #endif // !CLANGPARSER_H
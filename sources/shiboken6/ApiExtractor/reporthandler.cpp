@@ -7,6 +7,7 @@
 #include "qtcompat.h"
 
 #include <QtCore/QElapsedTimer>
+#include <QtCore/QMutex>
 #include <QtCore/QSet>
 #include <cstring>
 #include <cstdarg>
@@ -36,6 +37,8 @@ static bool m_withinProgress = false;
 static QByteArray m_progressMessage;
 static int m_step_warning = 0;
 static QElapsedTimer m_timer;
+// Serializes the output of messages from generator threads
+static QMutex m_messageMutex;
 
 Q_LOGGING_CATEGORY(lcShiboken, "qt.shiboken")
 Q_LOGGING_CATEGORY(lcShibokenDoc, "qt.shiboken.doc")
@@ -104,6 +107,7 @@ void ReportHandler::messageOutput(QtMsgType type, const QMessageLogContext &cont
 {
     // Check for file location separator added by SourceLocation
     auto fileLocationPos = text.indexOf(u":\t");
+    QMutexLocker locker(&m_messageMutex);
     if (type == QtWarningMsg) {
         if (m_silent || m_reportedWarnings.contains(text))
             return;
@@ -8,6 +8,7 @@
 #include <abstractmetafunction.h>
 #include <abstractmetalang.h>
 #include <usingmember.h>
+#include <typedatabase.h>
 #include <typesystem.h>
 
 #include <qtcompat.h>
@@ -775,4 +776,65 @@ public:
     QCOMPARE(generateCount, 3);
 }
 
+void TestAbstractMetaClass::testRejections()
+{
+    const char cppCode[] = R"CPP(
+class Private {};
+class TestClass {
+public:
+    void alpha();
+    void beta();
+    void betaPrivate();
+    void gamma();
+    int field1;
+    int field2;
+};
+class OtherClass {
+public:
+    void alpha();
+    void gamma();
+};
+)CPP";
+
+    const char xmlCode[] = R"XML(
+<typesystem package='Foo'>
+    <primitive-type name='int'/>
+    <rejection class='Private'/>
+    <rejection class='*' function-name='gamma'/>
+    <rejection class='TestClass' function-name='^beta.*$'/>
+    <rejection class='TestClass' function-name='gamma'/>
+    <rejection class='^Test.*$' function-name='alpha'/>
+    <rejection class='TestClass' field-name='field2'/>
+    <object-type name='TestClass'/>
+    <object-type name='OtherClass'/>
+</typesystem>
+)XML";
+
+    QScopedPointer<AbstractMetaBuilder> builder(TestUtil::parse(cppCode, xmlCode));
+    QVERIFY(builder);
+    AbstractMetaClassList classes = builder->classes();
+    QVERIFY(!AbstractMetaClass::findClass(classes, "Private"));
+    const auto tc = AbstractMetaClass::findClass(classes, "TestClass");
+    QVERIFY(tc);
+    QVERIFY(!tc->findFunction("alpha"));
+    QVERIFY(!tc->findFunction("beta"));
+    QVERIFY(!tc->findFunction("betaPrivate"));
+    QVERIFY(!tc->findFunction("gamma"));
+    QCOMPARE(tc->fields().size(), 1);
+    QCOMPARE(tc->fields().constFirst().name(), u"field1");
+    const auto oc = AbstractMetaClass::findClass(classes, "OtherClass");
+    QVERIFY(oc);
+    QVERIFY(oc->findFunction("alpha"));
+    QVERIFY(!oc->findFunction("gamma"));
+
+    // The first matching rejection is reported
+    auto *db = TypeDatabase::instance();
+    QString reason;
+    QVERIFY(db->isFunctionRejected(u"TestClass"_s, u"gamma"_s, &reason));
+    QVERIFY2(reason.contains(u"^.*$"), qPrintable(reason));
+    QVERIFY(db->isClassRejected(u"Private"_s));
+    QVERIFY(!db->isClassRejected(u"PrivateClass"_s));
+    QVERIFY(!db->isFunctionRejected(u"OtherClass"_s, u"beta"_s));
+}
+
 QTEST_APPLESS_MAIN(TestAbstractMetaClass)
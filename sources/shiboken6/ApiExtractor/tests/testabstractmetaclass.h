@@ -33,6 +33,7 @@ private slots:
     void testUsingTemplateMembers_data();
     void testUsingTemplateMembers();
     void testGenerateFunctions();
+    void testRejections();
 };
 
 #endif // TESTABSTRACTMETACLASS_H
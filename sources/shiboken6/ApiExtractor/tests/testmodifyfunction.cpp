@@ -267,6 +267,73 @@ struct A {
     QVERIFY(getter2->allowThread()); // Forced to true simple getter
 }
 
+void TestModifyFunction::testAllowThreadRule()
+{
+    const char cppCode[] =R"CPP(\
+struct A {
+    void waitForA();
+    void waitForB();
+    void copy();
+    int getter() const;
+};
+struct B {
+    void waitForA();
+    void copy();
+};
+void waitForGlobal();
+)CPP";
+
+    const char xmlCode[] = R"XML(
+<typesystem package='Foo' allow-thread='auto'>
+    <primitive-type name='int'/>
+    <allow-thread-rule function-name='^waitFor.*$' allow-thread='yes'/>
+    <allow-thread-rule class='A' function-name='copy' allow-thread='no'/>
+    <allow-thread-rule class='^.*$' function-name='getter' allow-thread='yes'/>
+    <object-type name='A'>
+        <modify-function signature='waitForB()' allow-thread='no'/>
+    </object-type>
+    <object-type name='B' allow-thread='no'/>
+    <function signature='waitForGlobal()'/>
+</typesystem>
+)XML";
+    QScopedPointer<AbstractMetaBuilder> builder(TestUtil::parse(cppCode, xmlCode, false));
+    QVERIFY(builder);
+    const auto classA = AbstractMetaClass::findClass(builder->classes(), "A");
+    QVERIFY(classA);
+    const auto classB = AbstractMetaClass::findClass(builder->classes(), "B");
+    QVERIFY(classB);
+
+    // Rule matching all classes
+    auto f = classA->findFunction("waitForA");
+    QVERIFY(f);
+    QVERIFY(f->allowThread());
+    // modify-function takes precedence over the rule
+    f = classA->findFunction("waitForB");
+    QVERIFY(f);
+    QVERIFY(!f->allowThread());
+    // Rule matching class A only, overriding the type system 'auto'
+    f = classA->findFunction("copy");
+    QVERIFY(f);
+    QVERIFY(!f->allowThread());
+    // Rule forcing a simple getter
+    f = classA->findFunction("getter");
+    QVERIFY(f);
+    QVERIFY(f->allowThread());
+
+    // The rule takes precedence over the class
+    f = classB->findFunction("waitForA");
+    QVERIFY(f);
+    QVERIFY(f->allowThread());
+    f = classB->findFunction("copy");
+    QVERIFY(f);
+    QVERIFY(!f->allowThread());
+
+    // Global function
+    const auto globalFunctions = builder->globalFunctions();
+    QCOMPARE(globalFunctions.size(), 1);
+    QVERIFY(globalFunctions.constFirst()->allowThread());
+}
+
 void TestModifyFunction::testGlobalFunctionModification()
 {
     const char cppCode[] = "\
@@ -13,6 +13,7 @@ class TestModifyFunction : public QObject
         void testOwnershipTransfer();
         void testWithApiVersion();
         void testAllowThread();
+        void testAllowThreadRule();
         void testRenameArgument_data();
         void testRenameArgument();
         void invalidateAfterUse();
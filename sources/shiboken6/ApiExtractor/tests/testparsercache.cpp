@@ -0,0 +1,94 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "testparsercache.h"
+#include <QtTest/QTest>
+#include <abstractmetafunction.h>
+#include <abstractmetalang.h>
+#include <apiextractor.h>
+#include <apiextractorresult.h>
+#include <clangparser/clangparser.h>
+#include <reporthandler.h>
+#include <typedatabase.h>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QScopeGuard>
+#include <QtCore/QTemporaryDir>
+
+#include <optional>
+
+using namespace Qt::StringLiterals;
+
+static bool writeFile(const QString &fileName, const QByteArray &contents)
+{
+    QFile file(fileName);
+    return file.open(QIODevice::WriteOnly) && file.write(contents) == contents.size();
+}
+
+static std::optional<ApiExtractorResult> runExtractor(const QString &typeSystemFileName,
+                                                      const QString &headerFileName)
+{
+    ReportHandler::setSilent(true);
+    ReportHandler::startTimer();
+    TypeDatabase::instance(true);
+    ApiExtractor extractor;
+    extractor.setTypeSystem(typeSystemFileName);
+    extractor.setCppFileNames({QFileInfo(headerFileName)});
+    return extractor.run({});
+}
+
+static bool hasFunction(const ApiExtractorResult &result, const char *name)
+{
+    const auto classA = AbstractMetaClass::findClass(result.classes(), "A");
+    return classA && classA->findFunction(name);
+}
+
+void TestParserCache::testSecondRunHitsCache()
+{
+    QTemporaryDir dir;
+    QVERIFY2(dir.isValid(), qPrintable(dir.errorString()));
+    const QString header = dir.filePath(u"cached.h"_s);
+    const QString typeSystem = dir.filePath(u"typesystem_cached.xml"_s);
+    const QString cacheDirectory = dir.filePath(u"cache"_s);
+    QVERIFY(writeFile(header, "struct A { void f(); };\n"));
+    QVERIFY(writeFile(typeSystem,
+                      "<typesystem package='Cached'><value-type name='A'/></typesystem>\n"));
+
+    clang::setParserCacheDirectory(cacheDirectory);
+    const auto cleanup = qScopeGuard([] { clang::setParserCacheDirectory({}); });
+
+    auto result = runExtractor(typeSystem, header);
+    QVERIFY(result.has_value());
+    QVERIFY(hasFunction(result.value(), "f"));
+    const QFileInfoList astFiles = QDir(cacheDirectory).entryInfoList({u"*.ast"_s}, QDir::Files);
+    QCOMPARE(astFiles.size(), 1);
+    const QString astFileName = astFiles.constFirst().absoluteFilePath();
+
+    // Date back the unit to detect whether a run rewrites it.
+    const QDateTime past = QDateTime::currentDateTime().addDays(-1);
+    {
+        QFile astFile(astFileName);
+        QVERIFY(astFile.open(QIODevice::ReadWrite));
+        QVERIFY(astFile.setFileTime(past, QFileDevice::FileModificationTime));
+    }
+
+    // An identical run loads the unit.
+    result = runExtractor(typeSystem, header);
+    QVERIFY(result.has_value());
+    QVERIFY(hasFunction(result.value(), "f"));
+    QVERIFY(QFileInfo(astFileName).lastModified() < past.addSecs(60));
+    QCOMPARE(QDir(cacheDirectory).entryList({u"*.ast"_s}, QDir::Files).size(), 1);
+
+    // A modified header replaces the entry.
+    QVERIFY(writeFile(header, "struct A { void f(); void g(); };\n"));
+    result = runExtractor(typeSystem, header);
+    QVERIFY(result.has_value());
+    QVERIFY(hasFunction(result.value(), "g"));
+    QVERIFY(QFileInfo(astFileName).lastModified() > past.addSecs(60));
+    QCOMPARE(QDir(cacheDirectory).entryList({u"*.ast"_s}, QDir::Files).size(), 1);
+}
+
+QTEST_APPLESS_MAIN(TestParserCache)
@@ -0,0 +1,16 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef TESTPARSERCACHE_H
+#define TESTPARSERCACHE_H
+
+#include <QtCore/QObject>
+
+class TestParserCache : public QObject
+{
+    Q_OBJECT
+private slots:
+    void testSecondRunHitsCache();
+};
+
+#endif
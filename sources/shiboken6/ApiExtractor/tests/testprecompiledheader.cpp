@@ -0,0 +1,153 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "testprecompiledheader.h"
+#include <QtTest/QTest>
+#include <abstractmetafunction.h>
+#include <abstractmetalang.h>
+#include <apiextractor.h>
+#include <apiextractorresult.h>
+#include <clangparser/clangparser.h>
+#include <reporthandler.h>
+#include <typedatabase.h>
+
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QRegularExpression>
+
+#include <optional>
+
+using namespace Qt::StringLiterals;
+
+static const char baseHeaderContents[] = R"(#ifndef BASE_H
+#define BASE_H
+struct Base { void f(); };
+#endif
+)";
+
+static const char derivedHeaderContents[] = R"(#include "base.h"
+struct Derived : public Base { void h(); };
+)";
+
+static const char baseTypeSystem[] = R"(<typesystem package='Base'>
+    <value-type name='Base'/>
+</typesystem>
+)";
+
+static const char derivedTypeSystem[] = R"(<typesystem package='Derived'>
+    <value-type name='Base'/>
+    <value-type name='Derived'/>
+</typesystem>
+)";
+
+// Warning of the fallback to parsing without the precompiled header
+static const QRegularExpression fallbackWarning(u"precompiled header .* failed"_s);
+
+static bool writeFile(const QString &fileName, const QByteArray &contents)
+{
+    QFile file(fileName);
+    return file.open(QIODevice::WriteOnly) && file.write(contents) == contents.size();
+}
+
+static std::optional<ApiExtractorResult> runExtractor(const QString &typeSystemFileName,
+                                                      const QString &headerFileName)
+{
+    ReportHandler::setSilent(true);
+    ReportHandler::startTimer();
+    TypeDatabase::instance(true);
+    ApiExtractor extractor;
+    extractor.setTypeSystem(typeSystemFileName);
+    extractor.setCppFileNames({QFileInfo(headerFileName)});
+    return extractor.run({});
+}
+
+static bool hasFunction(const ApiExtractorResult &result, const char *className,
+                        const char *name)
+{
+    const auto metaClass = AbstractMetaClass::findClass(result.classes(), className);
+    return metaClass && metaClass->findFunction(name);
+}
+
+void TestPrecompiledHeader::init()
+{
+    QVERIFY2(m_dir.isValid(), qPrintable(m_dir.errorString()));
+    m_derivedHeader = m_dir.filePath(u"derived.h"_s);
+    m_derivedTypeSystem = m_dir.filePath(u"typesystem_derived.xml"_s);
+    m_precompiledHeader = m_dir.filePath(u"base.pch"_s);
+    QVERIFY(writeFile(m_derivedHeader, derivedHeaderContents));
+    QVERIFY(writeFile(m_derivedTypeSystem, derivedTypeSystem));
+}
+
+void TestPrecompiledHeader::cleanup()
+{
+    clang::setPrecompiledHeader({});
+    clang::setPrecompiledHeaderOutput({});
+}
+
+// Parse the base module, saving the precompiled header.
+bool TestPrecompiledHeader::writeBaseModule(const QByteArray &baseHeader)
+{
+    const QString header = m_dir.filePath(u"base.h"_s);
+    const QString typeSystem = m_dir.filePath(u"typesystem_base.xml"_s);
+    if (!writeFile(header, baseHeader) || !writeFile(typeSystem, baseTypeSystem))
+        return false;
+    clang::setPrecompiledHeader({});
+    clang::setPrecompiledHeaderOutput(m_precompiledHeader);
+    const auto result = runExtractor(typeSystem, header);
+    clang::setPrecompiledHeaderOutput({});
+    return result.has_value() && hasFunction(result.value(), "Base", "f")
+        && QFileInfo::exists(m_precompiledHeader);
+}
+
+void TestPrecompiledHeader::testDependencyPrecompiledHeader()
+{
+    QVERIFY(writeBaseModule(baseHeaderContents));
+
+    // The dependent module sees the classes of the precompiled header.
+    QTest::failOnWarning(fallbackWarning);
+    clang::setPrecompiledHeader(m_precompiledHeader);
+    const auto result = runExtractor(m_derivedTypeSystem, m_derivedHeader);
+    QVERIFY(result.has_value());
+    QVERIFY(hasFunction(result.value(), "Base", "f"));
+    QVERIFY(hasFunction(result.value(), "Derived", "h"));
+    QVERIFY(clang::includedFiles().contains(m_precompiledHeader));
+}
+
+void TestPrecompiledHeader::testStalePrecompiledHeader()
+{
+    QVERIFY(writeBaseModule(baseHeaderContents));
+
+    // A header modified after saving the precompiled header invalidates it;
+    // the headers are parsed again.
+    QByteArray modifiedHeader = baseHeaderContents;
+    modifiedHeader.replace("void f();", "void f(); void g();");
+    QVERIFY(writeFile(m_dir.filePath(u"base.h"_s), modifiedHeader));
+    QTest::ignoreMessage(QtWarningMsg, fallbackWarning);
+    clang::setPrecompiledHeader(m_precompiledHeader);
+    auto result = runExtractor(m_derivedTypeSystem, m_derivedHeader);
+    QVERIFY(result.has_value());
+    QVERIFY(hasFunction(result.value(), "Base", "g"));
+    QVERIFY(hasFunction(result.value(), "Derived", "h"));
+
+    // Same for a file which is not a precompiled header.
+    QVERIFY(writeFile(m_precompiledHeader, "garbage"));
+    QTest::ignoreMessage(QtWarningMsg, fallbackWarning);
+    result = runExtractor(m_derivedTypeSystem, m_derivedHeader);
+    QVERIFY(result.has_value());
+    QVERIFY(hasFunction(result.value(), "Base", "g"));
+    QVERIFY(hasFunction(result.value(), "Derived", "h"));
+}
+
+void TestPrecompiledHeader::testMissingPrecompiledHeader()
+{
+    // A missing precompiled header (dependency not built yet) is ignored.
+    QVERIFY(writeFile(m_dir.filePath(u"base.h"_s), baseHeaderContents));
+    QTest::failOnWarning(fallbackWarning);
+    clang::setPrecompiledHeader(m_dir.filePath(u"missing.pch"_s));
+    const auto result = runExtractor(m_derivedTypeSystem, m_derivedHeader);
+    QVERIFY(result.has_value());
+    QVERIFY(hasFunction(result.value(), "Base", "f"));
+    QVERIFY(hasFunction(result.value(), "Derived", "h"));
+}
+
+QTEST_APPLESS_MAIN(TestPrecompiledHeader)
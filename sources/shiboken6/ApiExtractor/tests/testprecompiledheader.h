@@ -0,0 +1,29 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef TESTPRECOMPILEDHEADER_H
+#define TESTPRECOMPILEDHEADER_H
+
+#include <QtCore/QObject>
+#include <QtCore/QTemporaryDir>
+
+class TestPrecompiledHeader : public QObject
+{
+    Q_OBJECT
+private slots:
+    void init();
+    void cleanup();
+    void testDependencyPrecompiledHeader();
+    void testStalePrecompiledHeader();
+    void testMissingPrecompiledHeader();
+
+private:
+    bool writeBaseModule(const QByteArray &baseHeader);
+
+    QTemporaryDir m_dir;
+    QString m_derivedHeader;
+    QString m_derivedTypeSystem;
+    QString m_precompiledHeader;
+};
+
+#endif
@@ -35,13 +35,17 @@
 #include <QtCore/QFile>
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
+#include <QtCore/QFileInfo>
 #include <QtCore/QList>
 #include <QtCore/QRegularExpression>
+#include <QtCore/QSet>
 #include <QtCore/QVersionNumber>
 #include <QtCore/QXmlStreamReader>
 #include "reporthandler.h"
 
 #include <algorithm>
+#include <array>
+#include <optional>
 #include <utility>
 
 using namespace Qt::StringLiterals;
@@ -109,9 +113,118 @@ struct SuppressedWarning
     QRegularExpression pattern;
     QString rawText;
     bool generate; // Current type system
+    bool wildcard; // Legacy syntax, pattern consists of escaped text and ".*"
     mutable bool matched = false;
 };
 
+// Return the fixed string of a rejection pattern created from a name by
+// setRejectionRegularExpression() ("^<escaped name>$").
+static std::optional<QString> fixedRejectionString(const QString &pattern)
+{
+    if (pattern.size() < 2 || !pattern.startsWith(u'^') || !pattern.endsWith(u'$'))
+        return std::nullopt;
+    QString result;
+    const auto end = pattern.size() - 1;
+    for (qsizetype i = 1; i < end; ++i) {
+        if (pattern.at(i) == u'\\' && ++i == end)
+            return std::nullopt;
+        result.append(pattern.at(i));
+    }
+    if (u'^' + QRegularExpression::escape(result) + u'$' != pattern)
+        return std::nullopt;
+    return result;
+}
+
+static bool isWildcardRejection(const QRegularExpression &re)
+{
+    return re.pattern() == "^.*$"_L1;
+}
+
+// Pointer to the member of TypeRejection to be matched
+using TypeRejectionPattern = QRegularExpression TypeRejection::*;
+
+// Index for matching one pattern of the rejections. Fixed names are looked
+// up in a hash, only the regular expressions are matched. As with a linear
+// search, the first matching rejection (lowest index) is returned.
+struct RejectionNameIndex
+{
+    void add(const TypeRejection &r, TypeRejectionPattern pattern, qsizetype index);
+    qsizetype find(const QList<TypeRejection> &rejections, TypeRejectionPattern pattern,
+                   const QString &name, qsizetype notFound) const;
+
+    QHash<QString, qsizetype> fixedNames; // Name -> first index
+    QList<qsizetype> patterns; // Indexes of regular expressions and "*"
+};
+
+void RejectionNameIndex::add(const TypeRejection &r, TypeRejectionPattern pattern,
+                             qsizetype index)
+{
+    const auto name = fixedRejectionString((r.*pattern).pattern());
+    if (!name.has_value())
+        patterns.append(index);
+    else if (!fixedNames.contains(name.value()))
+        fixedNames.insert(name.value(), index);
+}
+
+// Return the index of the first matching rejection or notFound, which also
+// serves as upper limit.
+qsizetype RejectionNameIndex::find(const QList<TypeRejection> &rejections,
+                                   TypeRejectionPattern pattern,
+                                   const QString &name, qsizetype notFound) const
+{
+    qsizetype result = std::min(fixedNames.value(name, notFound), notFound);
+    for (auto index : patterns) {
+        if (index >= result)
+            break;
+        const QRegularExpression &re = rejections.at(index).*pattern;
+        if (isWildcardRejection(re) || re.match(name).hasMatch())
+            return index;
+    }
+    return result;
+}
+
+// Index of the rejections of a match type other than ExcludeClass,
+// grouped by class name.
+struct RejectionIndex
+{
+    void add(const TypeRejection &r, qsizetype index);
+    qsizetype find(const QList<TypeRejection> &rejections, const QString &className,
+                   const QString &name) const;
+
+    QHash<QString, RejectionNameIndex> fixedClasses;
+    RejectionNameIndex anyClass; // class="*"
+    QList<qsizetype> classPatterns; // Indexes of class regular expressions
+};
+
+void RejectionIndex::add(const TypeRejection &r, qsizetype index)
+{
+    if (isWildcardRejection(r.className)) {
+        anyClass.add(r, &TypeRejection::pattern, index);
+    } else if (const auto className = fixedRejectionString(r.className.pattern())) {
+        fixedClasses[className.value()].add(r, &TypeRejection::pattern, index);
+    } else {
+        classPatterns.append(index);
+    }
+}
+
+qsizetype RejectionIndex::find(const QList<TypeRejection> &rejections,
+                               const QString &className, const QString &name) const
+{
+    qsizetype result = rejections.size();
+    const auto it = fixedClasses.constFind(className);
+    if (it != fixedClasses.cend())
+        result = it.value().find(rejections, &TypeRejection::pattern, name, result);
+    result = anyClass.find(rejections, &TypeRejection::pattern, name, result);
+    for (auto index : classPatterns) {
+        if (index >= result)
+            break;
+        const TypeRejection &r = rejections.at(index);
+        if (r.pattern.match(name).hasMatch() && r.className.match(className).hasMatch())
+            return index;
+    }
+    return result;
+}
+
 QList<OptionDescription> TypeDatabase::options()
 {
     return {
@@ -259,8 +372,10 @@ struct TypeDatabasePrivate : public TypeDatabaseOptions
     template <class Type, class Predicate>
     QList<std::shared_ptr<const Type> > findTypesByTypeHelper(Predicate pred) const;
     TypeEntryPtr resolveTypeDefEntry(const TypedefEntryPtr &typedefEntry, QString *errorMessage);
-    template <class String>
-    bool isSuppressedWarningHelper(const String &s) const;
+    qsizetype findSuppressedWarning(QStringView s) const;
+    void updateSuppressedWarningsExpression() const;
+    qsizetype findRejection(TypeRejection::MatchType matchType,
+                            const QString &className, const QString &name) const;
     bool resolveSmartPointerInstantiations(const TypeDatabaseParserContextPtr &context);
     void formatDebug(QDebug &d) const;
     void formatBuiltinTypes(QDebug &d) const;
@@ -270,6 +385,12 @@ struct TypeDatabasePrivate : public TypeDatabaseOptions
     TypedefEntryMap m_typedefEntries;
     TemplateEntryMap m_templates;
     QList<SuppressedWarning> m_suppressedWarnings;
+    // Alternation of the suppressed warnings in wildcard syntax, one capture
+    // group per warning, built on demand.
+    mutable QRegularExpression m_suppressedWarningsExpression;
+    mutable QList<qsizetype> m_suppressedWarningsExpressionIndexes; // Capture group -> index
+    mutable bool m_suppressedWarningsExpressionDirty = false;
+    QList<qsizetype> m_suppressedWarningRegularExpressions; // Indexes of the other warnings
     QList<TypeSystemTypeEntryCPtr > m_typeSystemEntries; // maintain order, default is first.
 
     AddedFunctionList m_globalUserFunctions;
@@ -278,8 +399,12 @@ struct TypeDatabasePrivate : public TypeDatabaseOptions
     QStringList m_requiredTargetImports;
 
     QHash<QString, bool> m_parsedTypesystemFiles;
+    QSet<QString> m_inputFiles;
 
     QList<TypeRejection> m_rejections;
+    RejectionNameIndex m_classRejectionIndex;
+    std::array<RejectionIndex, TypeRejection::ReturnType> m_rejectionIndexes; // Other match types
+    QList<AllowThreadRule> m_allowThreadRules;
 };
 
 static const char ENV_TYPESYSTEMPATH[] = "TYPESYSTEMPATH";
@@ -332,25 +457,27 @@ struct IntTypeNormalizationEntry
 
 using IntTypeNormalizationEntries = QList<IntTypeNormalizationEntry>;
 
-static const IntTypeNormalizationEntries &intTypeNormalizationEntries()
+static IntTypeNormalizationEntries createIntTypeNormalizationEntries()
 {
-    static IntTypeNormalizationEntries result;
-    static bool firstTime = true;
-    if (firstTime) {
-        firstTime = false;
-        for (const auto &intType : {"char"_L1, "short"_L1, "int"_L1, "long"_L1}) {
-            if (!TypeDatabase::instance()->findType(u'u' + intType)) {
-                IntTypeNormalizationEntry entry;
-                entry.replacement = "unsigned "_L1 + intType;
-                entry.regex.setPattern("\\bu"_L1 + intType + "\\b"_L1);
-                Q_ASSERT(entry.regex.isValid());
-                result.append(entry);
-            }
+    IntTypeNormalizationEntries result;
+    for (const auto &intType : {"char"_L1, "short"_L1, "int"_L1, "long"_L1}) {
+        if (!TypeDatabase::instance()->findType(u'u' + intType)) {
+            IntTypeNormalizationEntry entry;
+            entry.replacement = "unsigned "_L1 + intType;
+            entry.regex.setPattern("\\bu"_L1 + intType + "\\b"_L1);
+            Q_ASSERT(entry.regex.isValid());
+            result.append(entry);
         }
     }
     return result;
 }
 
+static const IntTypeNormalizationEntries &intTypeNormalizationEntries()
+{
+    static const IntTypeNormalizationEntries result = createIntTypeNormalizationEntries();
+    return result;
+}
+
 // Normalization helpers
 enum CharCategory { Space, Identifier, Other };
 
@@ -679,45 +806,86 @@ QDebug operator<<(QDebug d, const TypeRejection &r)
 
 void TypeDatabase::addRejection(const TypeRejection &r)
 {
-    d->m_rejections << r;
+    const auto index = d->m_rejections.size();
+    d->m_rejections.append(r);
+    if (r.matchType == TypeRejection::ExcludeClass)
+        d->m_classRejectionIndex.add(r, &TypeRejection::className, index);
+    else
+        d->m_rejectionIndexes[r.matchType - 1].add(r, index);
 }
 
 // Match class name only
 bool TypeDatabase::isClassRejected(const QString& className, QString *reason) const
 {
-    for (const TypeRejection& r : d->m_rejections) {
-        if (r.matchType == TypeRejection::ExcludeClass && r.className.match(className).hasMatch()) {
-            r.matched = true;
-            if (reason)
-                *reason = msgRejectReason(r);
-            return true;
-        }
-    }
-    return false;
+    const auto index = d->m_classRejectionIndex.find(d->m_rejections, &TypeRejection::className,
+                                                     className, d->m_rejections.size());
+    if (index == d->m_rejections.size())
+        return false;
+    const TypeRejection &r = d->m_rejections.at(index);
+    r.matched = true;
+    if (reason)
+        *reason = msgRejectReason(r);
+    return true;
 }
 
 // Match class name and function/enum/field
-static bool findRejection(const QList<TypeRejection> &rejections,
+qsizetype TypeDatabasePrivate::findRejection(TypeRejection::MatchType matchType,
+                                             const QString &className,
+                                             const QString &name) const
+{
+    Q_ASSERT(matchType != TypeRejection::ExcludeClass);
+    return m_rejectionIndexes[matchType - 1].find(m_rejections, className, name);
+}
+
+static bool findRejection(const TypeDatabasePrivate *d,
                           TypeRejection::MatchType matchType,
                           const QString& className, const QString& name,
                           QString *reason = nullptr)
 {
-    Q_ASSERT(matchType != TypeRejection::ExcludeClass);
-    for (const TypeRejection& r : rejections) {
-        if (r.matchType == matchType && r.pattern.match(name).hasMatch()
+    const auto index = d->findRejection(matchType, className, name);
+    if (index == d->m_rejections.size())
+        return false;
+    const TypeRejection &r = d->m_rejections.at(index);
+    r.matched = true;
+    if (reason)
+        *reason = msgRejectReason(r, name);
+    return true;
+}
+
+#ifndef QT_NO_DEBUG_STREAM
+QDebug operator<<(QDebug d, const AllowThreadRule &r)
+{
+    QDebugStateSaver saver(d);
+    d.noquote();
+    d.nospace();
+    d << "AllowThreadRule(class=" << r.className.pattern() << ", function="
+        << r.functionName.pattern() << ", allowThread=" << int(r.allowThread) << ')';
+    return d;
+}
+#endif // !QT_NO_DEBUG_STREAM
+
+void TypeDatabase::addAllowThreadRule(const AllowThreadRule &r)
+{
+    d->m_allowThreadRules.append(r);
+}
+
+// Return the value of the first matching rule
+TypeSystem::AllowThread TypeDatabase::allowThreadRule(const QString &className,
+                                                      const QString &functionName) const
+{
+    for (const auto &r : d->m_allowThreadRules) {
+        if (r.functionName.match(functionName).hasMatch()
             && r.className.match(className).hasMatch()) {
             r.matched = true;
-            if (reason)
-                *reason = msgRejectReason(r, name);
-            return true;
+            return r.allowThread;
         }
     }
-    return false;
+    return TypeSystem::AllowThread::Unspecified;
 }
 
 bool TypeDatabase::isEnumRejected(const QString& className, const QString& enumName, QString *reason) const
 {
-    return findRejection(d->m_rejections, TypeRejection::Enum, className, enumName, reason);
+    return findRejection(d, TypeRejection::Enum, className, enumName, reason);
 }
 
 TypeEntryPtr TypeDatabasePrivate::resolveTypeDefEntry(const TypedefEntryPtr &typedefEntry,
@@ -792,25 +960,25 @@ ConstantValueTypeEntryPtr
 bool TypeDatabase::isFunctionRejected(const QString& className, const QString& functionName,
                                       QString *reason) const
 {
-    return findRejection(d->m_rejections, TypeRejection::Function, className, functionName, reason);
+    return findRejection(d, TypeRejection::Function, className, functionName, reason);
 }
 
 bool TypeDatabase::isFieldRejected(const QString& className, const QString& fieldName,
                                    QString *reason) const
 {
-    return findRejection(d->m_rejections, TypeRejection::Field, className, fieldName, reason);
+    return findRejection(d, TypeRejection::Field, className, fieldName, reason);
 }
 
 bool TypeDatabase::isArgumentTypeRejected(const QString& className, const QString& typeName,
                                           QString *reason) const
 {
-    return findRejection(d->m_rejections, TypeRejection::ArgumentType, className, typeName, reason);
+    return findRejection(d, TypeRejection::ArgumentType, className, typeName, reason);
 }
 
 bool TypeDatabase::isReturnTypeRejected(const QString& className, const QString& typeName,
                                         QString *reason) const
 {
-    return findRejection(d->m_rejections, TypeRejection::ReturnType, className, typeName, reason);
+    return findRejection(d, TypeRejection::ReturnType, className, typeName, reason);
 }
 
 FlagsTypeEntryPtr TypeDatabase::findFlagsType(const QString &name) const
@@ -935,22 +1103,79 @@ bool TypeDatabase::addSuppressedWarning(const QString &warning, bool generate,
     }
     expression.setPatternOptions(expression.patternOptions() | QRegularExpression::MultilineOption);
 
-    d->m_suppressedWarnings.append({expression, warning, generate});
+    const bool wildcard = pattern != warning;
+    if (wildcard)
+        d->m_suppressedWarningsExpressionDirty = true;
+    else
+        d->m_suppressedWarningRegularExpressions.append(d->m_suppressedWarnings.size());
+    d->m_suppressedWarnings.append({expression, warning, generate, wildcard});
     return true;
 }
 
+void TypeDatabasePrivate::updateSuppressedWarningsExpression() const
+{
+    if (!m_suppressedWarningsExpressionDirty)
+        return;
+    m_suppressedWarningsExpressionDirty = false;
+    m_suppressedWarningsExpressionIndexes.clear();
+    QString pattern;
+    for (qsizetype i = 0, size = m_suppressedWarnings.size(); i < size; ++i) {
+        const auto &sw = m_suppressedWarnings.at(i);
+        if (sw.wildcard) {
+            if (!pattern.isEmpty())
+                pattern += u'|';
+            pattern += u'(' + sw.pattern.pattern() + u')';
+            m_suppressedWarningsExpressionIndexes.append(i);
+        }
+    }
+    m_suppressedWarningsExpression.setPattern(pattern);
+    m_suppressedWarningsExpression.setPatternOptions(QRegularExpression::MultilineOption);
+}
+
+// Return the index of the first matching suppressed warning, -1 if there is none
+qsizetype TypeDatabasePrivate::findSuppressedWarning(QStringView s) const
+{
+    // The alternation matches the first alternative at the leftmost position,
+    // which is the first matching warning only for single-line messages.
+    if (s.contains(u'\n')) {
+        auto wit = std::find_if(m_suppressedWarnings.cbegin(), m_suppressedWarnings.cend(),
+                                [&s] (const SuppressedWarning &e) {
+                                    return e.pattern.matchView(s).hasMatch();
+                                });
+        return wit != m_suppressedWarnings.cend() ? wit - m_suppressedWarnings.cbegin() : -1;
+    }
+
+    updateSuppressedWarningsExpression();
+    qsizetype result = m_suppressedWarnings.size();
+    if (!m_suppressedWarningsExpressionIndexes.isEmpty()) {
+        const auto match = m_suppressedWarningsExpression.matchView(s);
+        if (match.hasMatch()) {
+            for (qsizetype g = 0, count = m_suppressedWarningsExpressionIndexes.size(); g < count; ++g) {
+                if (match.hasCaptured(g + 1)) {
+                    result = m_suppressedWarningsExpressionIndexes.at(g);
+                    break;
+                }
+            }
+        }
+    }
+    for (auto index : m_suppressedWarningRegularExpressions) {
+        if (index >= result)
+            break;
+        if (m_suppressedWarnings.at(index).pattern.matchView(s).hasMatch())
+            return index;
+    }
+    return result < m_suppressedWarnings.size() ? result : -1;
+}
+
 bool TypeDatabase::isSuppressedWarning(QStringView s) const
 {
     if (!d->m_suppressWarnings)
         return false;
-    auto wit = std::find_if(d->m_suppressedWarnings.cbegin(), d->m_suppressedWarnings.cend(),
-                            [&s] (const SuppressedWarning &e) {
-                                return e.pattern.matchView(s).hasMatch();
-                            });
-    const bool found = wit != d->m_suppressedWarnings.cend();
-    if (found)
-        wit->matched = true;
-    return found;
+    const auto index = d->findSuppressedWarning(s);
+    if (index < 0)
+        return false;
+    d->m_suppressedWarnings.at(index).matched = true;
+    return true;
 }
 
 QString TypeDatabase::modifiedTypesystemFilepath(const QString& tsFile, const QString &currentPath) const
@@ -958,6 +1183,24 @@ QString TypeDatabase::modifiedTypesystemFilepath(const QString& tsFile, const QS
     return d->modifiedTypesystemFilepath(tsFile, currentPath);
 }
 
+void TypeDatabase::addInputFile(const QString &fileName)
+{
+    d->m_inputFiles.insert(QFileInfo(fileName).absoluteFilePath());
+}
+
+QStringList TypeDatabase::inputFiles() const
+{
+    QSet<QString> files = d->m_inputFiles;
+    for (auto it = d->m_parsedTypesystemFiles.cbegin(), end = d->m_parsedTypesystemFiles.cend();
+         it != end; ++it) {
+        if (it.value())
+            files.insert(QFileInfo(it.key()).absoluteFilePath());
+    }
+    QStringList result(files.cbegin(), files.cend());
+    result.sort();
+    return result;
+}
+
 void TypeDatabase::logUnmatched() const
 {
     for (auto &sw : d->m_suppressedWarnings) {
@@ -977,6 +1220,13 @@ void TypeDatabase::logUnmatched() const
                 d << " \"" << tr.pattern.pattern() << '"';
         }
     }
+
+    for (const auto &r : d->m_allowThreadRules) {
+        if (r.generate && !r.matched) {
+            qWarning("Unmatched allow-thread-rule: class %s \"%s\"",
+                     qPrintable(r.className.pattern()), qPrintable(r.functionName.pattern()));
+        }
+    }
 }
 
 QString TypeDatabasePrivate::modifiedTypesystemFilepath(const QString& tsFile,
@@ -7,6 +7,7 @@
 #include "include.h"
 #include "modifications_typedefs.h"
 #include "typedatabase_typedefs.h"
+#include "typesystem_enums.h"
 
 #include <QtCore/QRegularExpression>
 #include <QtCore/QStringList>
@@ -60,6 +61,21 @@ struct TypeRejection
 QDebug operator<<(QDebug d, const TypeRejection &r);
 #endif
 
+// <allow-thread-rule> setting the allow-thread value of all functions whose
+// class and name match and which do not have one set by modify-function.
+struct AllowThreadRule
+{
+    QRegularExpression className;
+    QRegularExpression functionName;
+    TypeSystem::AllowThread allowThread = TypeSystem::AllowThread::Unspecified;
+    bool generate; // Current type system
+    mutable bool matched = false;
+};
+
+#ifndef QT_NO_DEBUG_STREAM
+QDebug operator<<(QDebug d, const AllowThreadRule &r);
+#endif
+
 class TypeDatabase
 {
     TypeDatabase();
@@ -132,6 +148,10 @@ public:
     bool isReturnTypeRejected(const QString &className, const QString &typeName,
                               QString *reason = nullptr) const;
 
+    void addAllowThreadRule(const AllowThreadRule &);
+    TypeSystem::AllowThread allowThreadRule(const QString &className,
+                                            const QString &functionName) const;
+
     bool addType(const TypeEntryPtr &e, QString *errorMessage = nullptr);
     ConstantValueTypeEntryPtr addConstantValueTypeEntry(const QString &value,
                                                       const TypeEntryCPtr &parent);
@@ -189,6 +209,11 @@ public:
 
     QString modifiedTypesystemFilepath(const QString &tsFile, const QString &currentPath = QString()) const;
 
+    // Files read when parsing the typesystems (code snippets, entities) in
+    // addition to the typesystem files, for dependency tracking.
+    void addInputFile(const QString &fileName);
+    QStringList inputFiles() const;
+
     void logUnmatched() const;
 
 #ifndef QT_NO_DEBUG_STREAM
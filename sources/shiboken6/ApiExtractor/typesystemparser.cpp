@@ -31,6 +31,7 @@
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
+#include <QtCore/QHash>
 #include <QtCore/QRegularExpression>
 #include <QtCore/QSet>
 #include <QtCore/QStringView>
@@ -43,6 +44,7 @@
 #include <algorithm>
 #include <optional>
 #include <memory>
+#include <utility>
 
 using namespace Qt::StringLiterals;
 
@@ -70,6 +72,7 @@ constexpr auto flagsAttribute = "flags"_L1;
 constexpr auto forceAbstractAttribute = "force-abstract"_L1;
 constexpr auto forceIntegerAttribute = "force-integer"_L1;
 constexpr auto formatAttribute = "format"_L1;
+constexpr auto functionNameAttribute = "function-name"_L1;
 constexpr auto generateUsingAttribute = "generate-using"_L1;
 constexpr auto generateFunctionsAttribute = "generate-functions"_L1;
 constexpr auto classAttribute = "class"_L1;
@@ -169,36 +172,73 @@ static inline bool hasFileSnippetAttributes(const QXmlStreamAttributes *attribut
     return attributes->hasAttribute(fileAttribute);
 }
 
-// Extract a snippet from a file within annotation "// @snippet label".
-std::optional<QString>
-    extractSnippet(const QString &code, const QString &snippetLabel)
+// Snippets of a file within annotations "// @snippet label". The file is
+// scanned once for all labels since glue files contain hundreds of snippets.
+class SnippetFile
 {
-    if (snippetLabel.isEmpty())
-        return code;
-    const QString pattern = R"(^\s*//\s*@snippet\s+)"_L1
-        + QRegularExpression::escape(snippetLabel)
-        + R"(\s*$)"_L1;
-    const QRegularExpression snippetRe(pattern);
+public:
+    SnippetFile() = default;
+    explicit SnippetFile(const QString &code);
+
+    std::optional<QString> snippet(const QString &snippetLabel) const;
+
+private:
+    using LineRange = std::pair<qsizetype, qsizetype>;
+
+    QString m_code;
+    QStringList m_lines;
+    QHash<QString, LineRange> m_snippets; // Label -> lines between the annotations
+};
+
+SnippetFile::SnippetFile(const QString &code) :
+    m_code(code), m_lines(code.split(u'\n'))
+{
+    static const QRegularExpression snippetRe(R"(^\s*//\s*@snippet\s+(.+?)\s*$)"_L1);
     Q_ASSERT(snippetRe.isValid());
 
-    bool useLine = false;
-    bool foundLabel = false;
-    QString result;
-    const auto lines = QStringView{code}.split(u'\n');
-    for (const auto &line : lines) {
-        if (snippetRe.matchView(line).hasMatch()) {
-            foundLabel = true;
-            useLine = !useLine;
-            if (!useLine)
-                break; // End of snippet reached
-        } else if (useLine)
-            result += line.toString() + u'\n';
-    }
-    if (!foundLabel)
+    for (qsizetype i = 0, size = m_lines.size(); i < size; ++i) {
+        const auto match = snippetRe.matchView(m_lines.at(i));
+        if (match.hasMatch()) {
+            const QString label = match.captured(1);
+            auto it = m_snippets.find(label);
+            if (it == m_snippets.end())
+                m_snippets.insert(label, {i + 1, size}); // Unterminated: up to the end
+            else if (it.value().second == size)
+                it.value().second = i;
+        }
+    }
+}
+
+std::optional<QString> SnippetFile::snippet(const QString &snippetLabel) const
+{
+    if (snippetLabel.isEmpty())
+        return m_code;
+    const auto it = m_snippets.constFind(snippetLabel);
+    if (it == m_snippets.cend())
         return {};
+    QString result;
+    for (auto i = it.value().first; i < it.value().second; ++i)
+        result += m_lines.at(i) + u'\n';
     return CodeSnipAbstract::fixSpaces(result);
 }
 
+// Read a snippet file, caching it for further snippets
+static const SnippetFile *readSnippetFile(const QString &fileName, QString *errorMessage)
+{
+    static QHash<QString, SnippetFile> snippetFiles;
+
+    auto it = snippetFiles.constFind(fileName);
+    if (it == snippetFiles.cend()) {
+        QFile file(fileName);
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            *errorMessage = msgCannotOpenForReading(file);
+            return nullptr;
+        }
+        it = snippetFiles.insert(fileName, SnippetFile(QString::fromUtf8(file.readAll())));
+    }
+    return &it.value();
+}
+
 template <class EnumType>
 struct EnumLookup
 {
@@ -434,6 +474,7 @@ static const StackElementHash &stackElementHash()
         {u"add-conversion", StackElement::AddConversion},
         {u"add-function", StackElement::AddFunction},
         {u"add-pymethoddef", StackElement::AddPyMethodDef},
+        {u"allow-thread-rule", StackElement::AllowThreadRule},
         {u"array", StackElement::Array},
         {u"configuration", StackElement::Configuration},
         {u"container-type", StackElement::ContainerTypeEntry},
@@ -606,6 +647,7 @@ QString TypeSystemEntityResolver::readFile(const QString &entityName, QString *e
         *errorMessage = msgCannotOpenForReading(file);
         return {};
     }
+    TypeDatabase::instance()->addInputFile(path);
     QString result = QString::fromUtf8(file.readAll()).trimmed();
     // Remove license header comments on which QXmlStreamReader chokes
     if (result.startsWith(u"<!--")) {
@@ -781,6 +823,46 @@ static bool addRejection(TypeDatabase *database, bool generate, QXmlStreamAttrib
     return true;
 }
 
+static bool addAllowThreadRule(TypeDatabase *database, bool generate,
+                               QXmlStreamAttributes *attributes, QString *errorMessage)
+{
+    AllowThreadRule rule;
+    rule.generate = generate;
+    QString className = u"*"_s;
+    QString functionName;
+    for (auto i = attributes->size() - 1; i >= 0; --i) {
+        const auto name = attributes->at(i).qualifiedName();
+        if (name == classAttribute) {
+            className = attributes->takeAt(i).value().toString();
+        } else if (name == functionNameAttribute) {
+            functionName = attributes->takeAt(i).value().toString();
+        } else if (name == allowThreadAttribute) {
+            const auto attribute = attributes->takeAt(i);
+            const auto allowThreadOpt = allowThreadFromAttribute(attribute.value());
+            if (!allowThreadOpt.has_value()) {
+                *errorMessage = msgInvalidAttributeValue(attribute);
+                return false;
+            }
+            rule.allowThread = allowThreadOpt.value();
+        }
+    }
+
+    if (functionName.isEmpty()) {
+        *errorMessage = msgMissingAttribute(functionNameAttribute);
+        return false;
+    }
+    if (rule.allowThread == TypeSystem::AllowThread::Unspecified) {
+        *errorMessage = msgMissingAttribute(allowThreadAttribute);
+        return false;
+    }
+    if (!setRejectionRegularExpression(className, &rule.className, errorMessage)
+        || !setRejectionRegularExpression(functionName, &rule.functionName, errorMessage)) {
+        return false;
+    }
+    database->addAllowThreadRule(rule);
+    return true;
+}
+
 bool TypeSystemParser::parse(ConditionalStreamReader &reader)
 {
     m_error.clear();
@@ -1134,6 +1216,7 @@ bool TypeSystemParser::importFileElement(const QXmlStreamAttributes &atts)
             return false;
         }
     }
+    m_context->db->addInputFile(file.fileName());
 
     const auto quoteFrom = atts.value(quoteAfterLineAttribute);
     bool foundFromOk = quoteFrom.isEmpty();
@@ -2285,13 +2368,11 @@ bool TypeSystemParser::parseCustomConversion(const ConditionalStreamReader &,
             if (lang != TypeSystem::TargetLangCode)
                 return true;
 
-            QFile conversionSource(sourceFile);
-            if (!conversionSource.open(QIODevice::ReadOnly | QIODevice::Text)) {
-                m_error = msgCannotOpenForReading(conversionSource);
+            const auto *conversionSource = readSnippetFile(sourceFile, &m_error);
+            if (conversionSource == nullptr)
                 return false;
-            }
-            const auto conversionRuleOptional =
-                extractSnippet(QString::fromUtf8(conversionSource.readAll()), snippetLabel);
+            m_context->db->addInputFile(sourceFile);
+            const auto conversionRuleOptional = conversionSource->snippet(snippetLabel);
             if (!conversionRuleOptional.has_value()) {
                 m_error = msgCannotFindSnippet(sourceFile, snippetLabel);
                 return false;
@@ -3005,14 +3086,11 @@ std::optional<TypeSystemParser::Snippet>
                   + QDir::toNativeSeparators(result.fileName);
         return std::nullopt;
     }
-    QFile codeFile(resolved);
-    if (!codeFile.open(QIODevice::Text | QIODevice::ReadOnly)) {
-        m_error = msgCannotOpenForReading(codeFile);
+    const auto *codeFile = readSnippetFile(resolved, &m_error);
+    if (codeFile == nullptr)
         return std::nullopt;
-    }
-    const auto contentOptional = extractSnippet(QString::fromUtf8(codeFile.readAll()),
-                                                result.snippetLabel);
-    codeFile.close();
+    m_context->db->addInputFile(resolved);
+    const auto contentOptional = codeFile->snippet(result.snippetLabel);
     if (!contentOptional.has_value()) {
         m_error = msgCannotFindSnippet(resolved, result.snippetLabel);
         return std::nullopt;
@@ -3445,6 +3523,7 @@ bool TypeSystemParser::startElement(const ConditionalStreamReader &reader, Stack
         bool topLevel = element == StackElement::Root
                         || element == StackElement::SuppressedWarning
                         || element == StackElement::Rejection
+                        || element == StackElement::AllowThreadRule
                         || element == StackElement::LoadTypesystem
                         || element == StackElement::InjectCode
                         || element == StackElement::ExtraIncludes
@@ -3606,6 +3685,12 @@ bool TypeSystemParser::startElement(const ConditionalStreamReader &reader, Stack
                 return false;
             }
             break;
+        case StackElement::AllowThreadRule:
+            if (!addAllowThreadRule(m_context->db, m_generate == TypeEntry::GenerateCode,
+                                    &attributes, &m_error)) {
+                return false;
+            }
+            break;
         case StackElement::SystemInclude:
             if (!parseSystemInclude(reader, &attributes))
                 return false;
@@ -68,6 +68,7 @@ enum class StackElement {
             Root,
             SuppressedWarning,
             Rejection,
+            AllowThreadRule,
             LoadTypesystem,
             RejectEnumValue,
             Template,
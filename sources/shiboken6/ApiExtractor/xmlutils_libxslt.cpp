@@ -31,13 +31,14 @@ static void cleanup()
 
 static void ensureInitialized()
 {
-    static bool initialized = false;
-    if (!initialized) {
-        initialized = true;
+    // Thread-safe static initialization; documentation may be generated in parallel
+    static const bool initialized = [] {
         xmlInitParser();
         xsltInit();
         qAddPostRoutine(cleanup);
-    }
+        return true;
+    }();
+    Q_UNUSED(initialized);
 }
 
 // RAI Helpers for cleaning up libxml2/libxslt data
@@ -265,7 +265,11 @@ macro(shiboken_check_if_limited_api)
 
     message(STATUS "PYTHON_LIMITED_LIBRARIES: " ${PYTHON_LIMITED_LIBRARIES})
 
-    if(FORCE_LIMITED_API OR SHIBOKEN_PYTHON_LIMITED_API)
+    if(PYTHON_WITH_FREE_THREADING)
+        if(FORCE_LIMITED_API)
+            message(STATUS "The limited API is not available for free-threaded Python, disabling it.")
+        endif()
+    elseif(FORCE_LIMITED_API OR SHIBOKEN_PYTHON_LIMITED_API)
         set(PYTHON_LIMITED_API 1)
         if(WIN32)
             set(SHIBOKEN_PYTHON_LIBRARIES ${PYTHON_LIMITED_LIBRARIES})
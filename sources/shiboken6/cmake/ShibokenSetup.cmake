@@ -57,6 +57,21 @@ endif()
 option(FORCE_LIMITED_API "Enable the limited API." "yes")
 set(PYTHON_LIMITED_API 0)
 
+# Detect a free-threaded (no-GIL) build of Python 3.13+, which does not
+# support the limited API.
+if(SHIBOKEN_IS_CROSS_BUILD)
+    set(PYTHON_WITH_FREE_THREADING 0)
+else()
+    execute_process(
+        COMMAND ${Python_EXECUTABLE} -c "if True:
+            import sysconfig
+            print(bool(sysconfig.get_config_var('Py_GIL_DISABLED')))
+            "
+        OUTPUT_VARIABLE PYTHON_WITH_FREE_THREADING
+        OUTPUT_STRIP_TRAILING_WHITESPACE)
+endif()
+message(STATUS "PYTHON_WITH_FREE_THREADING: " ${PYTHON_WITH_FREE_THREADING})
+
 shiboken_check_if_limited_api()
 
 if(PYTHON_LIMITED_API)
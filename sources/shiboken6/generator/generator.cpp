@@ -26,19 +26,30 @@
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
+#include <QtCore/QMutex>
 #include <QtCore/QRegularExpression>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
+#include <QtCore/QWaitCondition>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <vector>
 
 using namespace Qt::StringLiterals;
 
 static constexpr auto ENABLE_PYSIDE_EXTENSIONS = "enable-pyside-extensions"_L1;
 static constexpr auto AVOID_PROTECTED_HACK = "avoid-protected-hack"_L1;
 static constexpr auto DISABLED_OPTIMIZATIONS = "unoptimize"_L1;
+static constexpr auto JOBS = "jobs"_L1;
 
 struct GeneratorOptions
 {
     bool usePySideExtensions = false;
     bool avoidProtectedHack = false;
     Generator::CodeOptimization optimizations = Generator::AllCodeOptimizations;
+    int jobs = 1; // Threads generating the class files, 0: number of processors
 };
 
 struct Generator::GeneratorPrivate
@@ -49,6 +60,8 @@ struct Generator::GeneratorPrivate
     QString licenseComment;
     AbstractMetaClassCList m_invisibleTopNamespaces;
     bool m_hasPrivateClasses = false;
+    // Contexts for which a file was generated, in class order
+    QList<GeneratorContext> m_generatedContexts;
     static GeneratorOptions m_options;
 };
 
@@ -100,7 +113,10 @@ QList<OptionDescription> Generator::options()
          u"Enable PySide extensions, such as support for signal/slots,\n"
           "use this if you are creating a binding for a Qt-based library."_s},
         {DISABLED_OPTIMIZATIONS,
-         "Disable optimization options"_L1}
+         "Disable optimization options"_L1},
+        {u"jobs=<count>"_s,
+         u"Number of threads generating the class files (default: 1,\n"
+          "0: number of processors). The generated files do not depend on it."_s}
     };
 }
 
@@ -150,6 +166,15 @@ bool GeneratorOptionsParser::handleOption(const QString & key, const QString & v
         return true;
     }
 
+    if (key == JOBS) {
+        bool ok{};
+        const int jobs = value.toInt(&ok);
+        if (!ok || jobs < 0)
+            return false;
+        m_options->jobs = jobs;
+        return true;
+    }
+
     return false;
 }
 
@@ -234,29 +259,175 @@ void Generator::setOutputDirectory(const QString &outDir)
     m_d->outDir = outDir;
 }
 
-bool Generator::generateFileForContext(const GeneratorContext &context)
+// Generates the code for a class into a buffer, returns nullptr if there
+// is nothing to be generated.
+std::unique_ptr<FileOut> Generator::generateFileOut(const GeneratorContext &context)
 {
     const auto cls = context.metaClass();
     auto typeEntry = cls->typeEntry();
 
     if (!shouldGenerate(typeEntry))
-        return true;
+        return {};
 
     const QString fileName = fileNameForContext(context);
     if (fileName.isEmpty())
-        return true;
+        return {};
 
     QString filePath = outputDirectory() + u'/'
         + subDirectoryForPackage(typeEntry->targetLangPackage())
         + u'/' + fileName;
-    FileOut fileOut(filePath);
+    auto fileOut = std::make_unique<FileOut>(filePath);
 
-    generateClass(fileOut.stream, context);
+    generateClass(fileOut->stream, context);
+
+    return fileOut;
+}
 
-    fileOut.done();
+bool Generator::generateFileForContext(const GeneratorContext &context)
+{
+    if (auto fileOut = generateFileOut(context)) {
+        fileOut->done();
+        m_d->m_generatedContexts.append(context);
+    }
     return true;
 }
 
+const QList<GeneratorContext> &Generator::generatedContexts() const
+{
+    return m_d->m_generatedContexts;
+}
+
+bool Generator::canGenerateClassesInParallel() const
+{
+    return false;
+}
+
+// Populate the lazily computed members of the code model (signatures,
+// names) which are then only read by the threads generating the classes.
+static void warmUpTypeEntryCaches(TypeEntryCPtr typeEntry)
+{
+    for ( ; typeEntry; typeEntry = typeEntry->parent()) {
+        typeEntry->shortName();
+        typeEntry->targetLangName();
+        typeEntry->targetLangEntryName();
+    }
+}
+
+static void warmUpTypeCaches(const AbstractMetaType &type)
+{
+    if (!type.typeEntry())
+        return;
+    warmUpTypeEntryCaches(type.typeEntry());
+    for (const auto &instantiation : type.instantiations())
+        warmUpTypeCaches(instantiation);
+    if (const auto *elementType = type.arrayElementType())
+        warmUpTypeCaches(*elementType);
+}
+
+static void warmUpFunctionCaches(const AbstractMetaFunctionCPtr &func)
+{
+    func->signature();
+    func->minimalSignature();
+    func->modifiedName();
+    func->overloadNumber();
+    warmUpTypeCaches(func->type());
+    for (const auto &arg : func->arguments()) {
+        warmUpTypeCaches(arg.type());
+        warmUpTypeCaches(arg.modifiedType());
+    }
+}
+
+static void warmUpClassCaches(const AbstractMetaClassCPtr &metaClass)
+{
+    metaClass->cppWrapper();
+    warmUpTypeEntryCaches(metaClass->typeEntry());
+    for (const auto &func : metaClass->functions())
+        warmUpFunctionCaches(func);
+}
+
+static void warmUpCaches(const ApiExtractorResult &api)
+{
+    getMaxTypeIndex(); // Computes the type indexes
+    for (const auto &typeEntry : TypeDatabase::instance()->entries())
+        warmUpTypeEntryCaches(typeEntry);
+    for (const auto &metaClass : api.classes())
+        warmUpClassCaches(metaClass);
+    for (const auto &smp : api.instantiatedSmartPointers()) {
+        warmUpClassCaches(smp.specialized);
+        warmUpTypeCaches(smp.type);
+    }
+    for (const auto &func : api.globalFunctions())
+        warmUpFunctionCaches(func);
+    for (const auto &type : api.instantiatedContainers())
+        warmUpTypeCaches(type);
+}
+
+struct GeneratedFile
+{
+    std::unique_ptr<FileOut> fileOut;
+    std::exception_ptr error;
+    bool finished = false;
+};
+
+// Generate the classes in a thread pool. The files are written by the
+// calling thread in the order of the contexts as they become available,
+// so that the output does not depend on the number of threads.
+void Generator::generateFilesInParallel(const QList<GeneratorContext> &contexts, int jobs)
+{
+    warmUpCaches(m_d->api);
+
+    const qsizetype count = contexts.size();
+    std::vector<GeneratedFile> results(size_t(count));
+    QMutex mutex;
+    QWaitCondition finishedCondition;
+    std::atomic<qsizetype> next{0};
+
+    auto worker = [&]() {
+        for (qsizetype i = next++; i < count; i = next++) {
+            GeneratedFile result;
+            try {
+                result.fileOut = generateFileOut(contexts.at(i));
+            } catch (...) {
+                result.error = std::current_exception();
+            }
+            result.finished = true;
+            QMutexLocker locker(&mutex);
+            results[i] = std::move(result);
+            finishedCondition.wakeAll();
+        }
+    };
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(jobs);
+    for (int j = 0; j < jobs; ++j)
+        pool.start(worker);
+
+    std::exception_ptr error;
+    for (qsizetype i = 0; i < count && !error; ++i) {
+        GeneratedFile result;
+        {
+            QMutexLocker locker(&mutex);
+            while (!results[i].finished)
+                finishedCondition.wait(&mutex);
+            result = std::move(results[i]);
+        }
+        try {
+            if (result.error)
+                std::rethrow_exception(result.error);
+            if (result.fileOut) {
+                result.fileOut->done();
+                m_d->m_generatedContexts.append(contexts.at(i));
+            }
+        } catch (...) {
+            error = std::current_exception();
+            next = count; // Stop the workers
+        }
+    }
+    pool.waitForDone();
+    if (error)
+        std::rethrow_exception(error);
+}
+
 QString Generator::getFileNameBaseForSmartPointer(const AbstractMetaType &smartPointerType)
 {
     const AbstractMetaType innerType = smartPointerType.getSmartPointerInnerType();
@@ -291,9 +462,11 @@ GeneratorContext
 
 bool Generator::generate()
 {
+    QList<GeneratorContext> contexts;
+    contexts.reserve(m_d->api.classes().size()
+                     + m_d->api.instantiatedSmartPointers().size());
     for (const auto &cls : m_d->api.classes()) {
-        if (!generateFileForContext(contextForClass(cls)))
-            return false;
+        contexts.append(contextForClass(cls));
         auto te = cls->typeEntry();
         if (shouldGenerate(te) && te->isPrivate())
             m_d->m_hasPrivateClasses = true;
@@ -304,9 +477,20 @@ bool Generator::generate()
         const auto instantiatedType = smp.type.instantiations().constFirst().typeEntry();
         if (instantiatedType->isComplex()) // not a C++ primitive
             pointeeClass = AbstractMetaClass::findClass(m_d->api.classes(), instantiatedType);
-        if (!generateFileForContext(contextForSmartPointer(smp.specialized, smp.type,
-                                                           pointeeClass))) {
-            return false;
+        contexts.append(contextForSmartPointer(smp.specialized, smp.type, pointeeClass));
+    }
+
+    int jobs = GeneratorPrivate::m_options.jobs;
+    if (jobs == 0)
+        jobs = QThread::idealThreadCount();
+    jobs = int(std::min(qsizetype(jobs), contexts.size()));
+
+    if (jobs > 1 && canGenerateClassesInParallel()) {
+        generateFilesInParallel(contexts, jobs);
+    } else {
+        for (const auto &context : std::as_const(contexts)) {
+            if (!generateFileForContext(context))
+                return false;
         }
     }
     return finishGeneration();
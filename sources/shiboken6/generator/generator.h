@@ -15,6 +15,7 @@
 class ApiExtractorResult;
 class GeneratorContext;
 class DefaultValue;
+class FileOut;
 struct OptionDescription;
 class OptionsParser;
 class TextStream;
@@ -144,6 +145,15 @@ protected:
     /// Generates a file for given AbstractMetaClass or AbstractMetaType (smart pointer case).
     bool generateFileForContext(const GeneratorContext &context);
 
+    /// Returns the contexts for which generateClass() was called, in the
+    /// order of the classes. For use in finishGeneration().
+    const QList<GeneratorContext> &generatedContexts() const;
+
+    /// Returns whether generateClass() may be called from several threads
+    /// (option "jobs"). It must then not modify the generator; module-level
+    /// data is collected in finishGeneration().
+    virtual bool canGenerateClassesInParallel() const;
+
     /// Returns the file base name for a smart pointer.
     static QString getFileNameBaseForSmartPointer(const AbstractMetaType &smartPointerType);
 
@@ -231,6 +241,9 @@ protected:
     static QString m_gsp;
 
 private:
+    std::unique_ptr<FileOut> generateFileOut(const GeneratorContext &context);
+    void generateFilesInParallel(const QList<GeneratorContext> &contexts, int jobs);
+
     struct GeneratorPrivate;
     GeneratorPrivate *m_d;
 };
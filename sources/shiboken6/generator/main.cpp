@@ -58,6 +58,7 @@ struct CommonOptions
     bool version = false;
     bool diff = false;
     bool dryRun = false;
+    QString depFile;
     bool logUnmatched = false;
     bool printBuiltinTypes = false;
 };
@@ -91,6 +92,9 @@ OptionDescriptions CommonOptionsParser::optionDescriptions()
          u"Path to the compiler for determining builtin include paths"_s},
         {u"generator-set=<\"generator module\">"_s,
          u"generator-set to be used. e.g. qtdoc"_s},
+        {u"depfile=<file>"_s,
+         u"Write a dependency file in Makefile syntax listing the headers,\n"
+          "typesystem and snippet files read (target: <file> without \".d\")"_s},
         {u"diff"_s, u"Print a diff of wrapper files"_s},
         {u"dry-run"_s, u"Dry run, do not generate wrapper files"_s},
         {u"-h"_s, {} },
@@ -183,6 +187,10 @@ bool CommonOptionsParser::handleOption(const QString &key, const QString &value,
         m_options->outputDirectory = value;
         return true;
     }
+    if (key == u"depfile") {
+        m_options->depFile = value;
+        return true;
+    }
     if (key == u"compiler") {
         if (!clang::setCompiler(value))
             throw Exception(u"Invalid value \""_s + value + u"\" passed to --compiler"_s);
@@ -238,6 +246,38 @@ static inline void printVerAndBanner()
         << "\nCopyright (C) 2016 The Qt Company Ltd.\n";
 }
 
+static QByteArray depFileEscape(const QString &fileName)
+{
+    QByteArray result = QFile::encodeName(QDir::fromNativeSeparators(fileName));
+    result.replace('$', "$$");
+    result.replace('#', "\\#");
+    result.replace(' ', "\\ ");
+    return result;
+}
+
+// Write a dependency file for the build system so that it reruns the
+// generator when a header, typesystem or snippet file changes.
+static bool writeDepFile(const QString &fileName, const QStringList &inputFiles,
+                         QString *errorMessage)
+{
+    QString target = fileName;
+    if (target.endsWith(u".d"))
+        target.chop(2);
+    QByteArray content = depFileEscape(target) + ':';
+    for (const auto &inputFile : inputFiles) {
+        if (!inputFile.startsWith(u':')) // Skip Qt resources
+            content += " \\\n  "_ba + depFileEscape(inputFile);
+    }
+    content += '\n';
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly) || file.write(content) != content.size()) {
+        *errorMessage = msgCannotOpenForWriting(file);
+        return false;
+    }
+    return true;
+}
+
 static inline void errorPrint(const QString &s, const QStringList &arguments)
 {
     std::cerr << appName << ": " << qPrintable(s) << "\nCommand line:\n";
@@ -392,6 +432,14 @@ int shibokenMain(const QStringList &argV)
          }
     }
 
+    if (!commonOptions.depFile.isEmpty()) {
+        QString errorMessage;
+        if (!writeDepFile(commonOptions.depFile, extractor.inputFiles(), &errorMessage)) {
+            errorPrint(errorMessage, argV);
+            return EXIT_FAILURE;
+        }
+    }
+
     if (commonOptions.logUnmatched)
         TypeDatabase::instance()->logUnmatched();
 
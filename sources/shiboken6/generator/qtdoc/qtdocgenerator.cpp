@@ -409,9 +409,6 @@ void QtDocGenerator::generateClass(TextStream &s, const GeneratorContext &classC
     AbstractMetaClassCPtr metaClass = classContext.metaClass();
     qCDebug(lcShibokenDoc).noquote().nospace() << "Generating Documentation for " << metaClass->fullName();
 
-    m_packages[metaClass->package()].classPages << fileNameForContext(classContext);
-
-    m_docParser->setPackageName(metaClass->package());
     m_docParser->fillDocumentation(std::const_pointer_cast<AbstractMetaClass>(metaClass));
 
     s << currentModule(metaClass->package()) << pyClass(metaClass->name());
@@ -1025,6 +1022,10 @@ static void writeFancyToc(TextStream& s, QAnyStringView title,
 
 bool QtDocGenerator::finishGeneration()
 {
+    // Collect the class pages here since generateClass() may run in parallel.
+    for (const auto &context : generatedContexts())
+        m_packages[context.metaClass()->package()].classPages << fileNameForContext(context);
+
     for (const auto &f : api().globalFunctions()) {
         auto ncf = std::const_pointer_cast<AbstractMetaFunction>(f);
         m_docParser->fillGlobalFunctionDocumentation(ncf);
@@ -1287,6 +1288,7 @@ bool QtDocGenerator::doSetup()
 
     m_docParser->setDocumentationDataDirectory(m_options.parameters.docDataDir);
     m_docParser->setLibrarySourceDirectory(m_options.parameters.libSourceDir);
+    m_docParser->setPackageName(packageName());
     m_options.parameters.outputDirectory = outputDirectory();
     return true;
 }
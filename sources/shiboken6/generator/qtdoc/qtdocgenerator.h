@@ -58,6 +58,7 @@ protected:
     static QString fileNameSuffix();
     QString fileNameForContext(const GeneratorContext &context) const override;
     void generateClass(TextStream &ts, const GeneratorContext &classContext) override;
+    bool canGenerateClassesInParallel() const override { return true; }
     bool finishGeneration() override;
 
 private:
@@ -14,6 +14,7 @@
 #include <QtCore/QFileInfo>
 #include <QtCore/QHash>
 #include <QtCore/QLoggingCategory>
+#include <QtCore/QMutex>
 #include <QtCore/QRegularExpression>
 #include <QtCore/QXmlStreamReader>
 
@@ -716,22 +717,20 @@ QString QtXmlToSphinx::readFromLocation(const QString &location, const QString &
 
 void QtXmlToSphinx::handleHeadingTag(QXmlStreamReader& reader)
 {
-    static int headingSize = 0;
-    static char type;
-    static char types[] = { '-', '^' };
+    static constexpr char types[] = { '-', '^' };
     QXmlStreamReader::TokenType token = reader.tokenType();
     if (token == QXmlStreamReader::StartElement) {
         uint typeIdx = reader.attributes().value(u"level"_s).toUInt();
         if (typeIdx >= sizeof(types))
-            type = types[sizeof(types)-1];
+            m_headingType = types[sizeof(types)-1];
         else
-            type = types[typeIdx];
+            m_headingType = types[typeIdx];
     } else if (token == QXmlStreamReader::EndElement) {
-        m_output << disableIndent << Pad(type, headingSize) << "\n\n"
+        m_output << disableIndent << Pad(m_headingType, m_headingSize) << "\n\n"
             << enableIndent;
     } else if (token == QXmlStreamReader::Characters) {
         m_output << "\n\n" << disableIndent;
-        headingSize = writeEscapedRstText(m_output, reader.text().trimmed());
+        m_headingSize = writeEscapedRstText(m_output, reader.text().trimmed());
         m_output << '\n' << enableIndent;
     }
 }
@@ -1070,26 +1069,23 @@ void QtXmlToSphinx::handleRowTag(QXmlStreamReader& reader)
         m_tables.back().appendRow({});
 }
 
-enum ListType { BulletList, OrderedList, EnumeratedList };
-
-static inline ListType webXmlListType(QStringView t)
+static inline QtXmlToSphinx::ListType webXmlListType(QStringView t)
 {
     if (t == u"enum")
-        return EnumeratedList;
+        return QtXmlToSphinx::EnumeratedList;
     if (t == u"ordered")
-        return OrderedList;
-    return BulletList;
+        return QtXmlToSphinx::OrderedList;
+    return QtXmlToSphinx::BulletList;
 }
 
 void QtXmlToSphinx::handleListTag(QXmlStreamReader& reader)
 {
-    static ListType listType = BulletList;
     QXmlStreamReader::TokenType token = reader.tokenType();
     if (token == QXmlStreamReader::StartElement) {
         m_tables.push({});
         auto &table = m_tables.back();
-        listType = webXmlListType(reader.attributes().value(u"type"_s));
-        if (listType == EnumeratedList) {
+        m_listType = webXmlListType(reader.attributes().value(u"type"_s));
+        if (m_listType == EnumeratedList) {
             table.appendRow(TableRow{TableCell(u"Constant"_s),
                                      TableCell(u"Description"_s)});
             table.setHeaderEnabled(true);
@@ -1099,12 +1095,12 @@ void QtXmlToSphinx::handleListTag(QXmlStreamReader& reader)
         m_output.outdent();
         const auto &table = m_tables.back();
         if (!table.isEmpty()) {
-            switch (listType) {
+            switch (m_listType) {
             case BulletList:
             case OrderedList: {
                 m_output << '\n';
-                const char *separator = listType == BulletList ? "* " : "#. ";
-                const char *indentLine = listType == BulletList ? "  " : "   ";
+                const char *separator = m_listType == BulletList ? "* " : "#. ";
+                const char *indentLine = m_listType == BulletList ? "  " : "   ";
                 for (const TableCell &cell : table.constFirst()) {
                     const auto itemLines = QStringView{cell.data}.split(u'\n');
                     m_output << separator << itemLines.constFirst() << '\n';
@@ -1244,6 +1240,10 @@ static bool copyImage(const QString &docDataDir, const QString &relativeSourceFi
                       const QString &outputDir, const QString &relativeTargetFile,
                       const QLoggingCategory &lc, QString *errorMessage)
 {
+    // Classes generated in parallel may refer to the same image
+    static QMutex mutex;
+    QMutexLocker locker(&mutex);
+
     QString targetFileName = outputDir + u'/' + relativeTargetFile;
     if (QFileInfo::exists(targetFileName))
         return true;
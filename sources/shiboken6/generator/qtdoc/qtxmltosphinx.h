@@ -46,6 +46,8 @@ public:
 
     using TableRow = QList<TableCell>;
 
+    enum ListType { BulletList, OrderedList, EnumeratedList };
+
     class Table
     {
         public:
@@ -167,6 +169,9 @@ private:
     const QtXmlToSphinxDocGeneratorInterface *m_generator;
     const QtXmlToSphinxParameters &m_parameters;
     int m_formattingDepth = 0;
+    int m_headingSize = 0;
+    char m_headingType = '-';
+    ListType m_listType = BulletList;
     bool m_insideBold = false;
     bool m_insideItalic = false;
     QString m_lastTagName;
@@ -51,6 +51,7 @@
 #include <QtCore/QTextStream>
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <memory>
 #include <set>
@@ -156,43 +157,60 @@ public:
         return s;
     }
 
+    /// Returns the number of names registered by the generated code so far,
+    /// used for reserving the table of converters.
+    static qsizetype nameCount() { return m_nameCount.load(); }
+
 private:
-    static void formatEntry(TextStream &s, QAnyStringView typeName,
-                            QAnyStringView varName, Flags flags,
-                            const char *indirection = "");
+    QString formatEntry(const QString &typeName) const;
 
     QAnyStringView m_typeName;
     QAnyStringView m_varName;
     Flags m_flags;
+
+    static std::atomic<qsizetype> m_nameCount; // Classes may be generated in parallel
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS(registerConverterName::Flags)
 
-void registerConverterName::formatEntry(TextStream &s, QAnyStringView typeName,
-                                        QAnyStringView varName, Flags flags,
-                                        const char *indirection)
+std::atomic<qsizetype> registerConverterName::m_nameCount{0};
+
+// Mirrors Shiboken::Conversions::converterNameHash() (64bit FNV-1a)
+static quint64 converterNameHash(const QByteArray &typeName)
 {
-    s << "Shiboken::Conversions::registerConverter"
-        << (flags.testFlag(Alias) ? "Alias" : "Name")
-        << '(' << varName << ", ";
-    if (flags.testFlag(TypeId))
-        s << "typeid(" << typeName << indirection << ").name()";
-    else
-        s << '"' << typeName << indirection << '"';
-    s << ");\n";
+    quint64 result = 14695981039346656037ULL;
+    for (const char c : typeName) {
+        result ^= static_cast<unsigned char>(c);
+        result *= 1099511628211ULL;
+    }
+    return result;
+}
+
+QString registerConverterName::formatEntry(const QString &typeName) const
+{
+    if (m_flags.testFlag(TypeId))
+        return "typeid("_L1 + typeName + ").name()"_L1;
+    return u'"' + typeName + u'"';
 }
 
+// Register all names of the type in one call to registerConverterNames()
+// passing their hashes unless there is only one or they are determined
+// at runtime (typeid()).
 void registerConverterName::format(TextStream &s) const
 {
     QAnyStringView typeName = m_typeName;
     const QAnyStringView varName = m_varName.isEmpty() ? converterVar : m_varName;
     auto flags = m_flags;
 
+    QStringList names;
+    QStringList aliases;
     while (true) {
-        formatEntry(s, typeName, varName, flags);
+        QStringList &target = flags.testFlag(Alias) ? aliases : names;
+        const QString name = typeName.toString();
+        target.append(name);
         if (flags.testFlag(Indirections)) {
-            formatEntry(s, typeName, varName, flags, "*");
-            formatEntry(s, typeName, varName, flags, "&");
+            target.append(name + u'*');
+            target.append(name + u'&');
         }
 
         if (!flags.testFlag(PartiallyQualifiedAliases))
@@ -203,6 +221,39 @@ void registerConverterName::format(TextStream &s) const
         typeName = typeName.sliced(pos + 2);
         flags.setFlag(Alias);
     }
+    m_nameCount += names.size() + aliases.size();
+
+    if (m_flags.testFlag(TypeId) || names.size() + aliases.size() == 1) {
+        for (const auto &name : std::as_const(names)) {
+            s << "Shiboken::Conversions::registerConverterName(" << varName << ", "
+                << formatEntry(name) << ");\n";
+        }
+        for (const auto &name : std::as_const(aliases)) {
+            s << "Shiboken::Conversions::registerConverterAlias(" << varName << ", "
+                << formatEntry(name) << ");\n";
+        }
+        return;
+    }
+
+    auto formatNames = [](TextStream &str, const QStringList &nameList) {
+        str << '{';
+        for (qsizetype i = 0, size = nameList.size(); i < size; ++i) {
+            const QString &name = nameList.at(i);
+            if (i > 0)
+                str << ", ";
+            str << "{0x" << QByteArray::number(converterNameHash(name.toUtf8()), 16)
+                << "ULL, \"" << name << "\"}";
+        }
+        str << '}';
+    };
+
+    s << "Shiboken::Conversions::registerConverterNames(" << varName << ",\n" << indent;
+    formatNames(s, names);
+    if (!aliases.isEmpty()) {
+        s << ",\n";
+        formatNames(s, aliases);
+    }
+    s << ");\n" << outdent;
 }
 
 // Protocol function name / function parameters / return type
@@ -300,16 +351,21 @@ QString CppGenerator::fileNameForContext(const GeneratorContext &context) const
     return fileNameForContextHelper(context, u"_wrapper.cpp"_s);
 }
 
-void CppGenerator::clearTpFuncs()
+// Functions that should not be registered under a name in PyMethodDef,
+// but under a special constant under slots. The values are filled per class.
+const CppGenerator::SlotFunctions &CppGenerator::tpSlotFunctions()
 {
-    // Functions that should not be registered under a name in PyMethodDef,
-    // but under a special constant under slots.
-    m_tpFuncs = {
-        {u"__str__"_s, {}}, {u"__str__"_s, {}},
-        {REPR_FUNCTION, {}}, {u"__iter__"_s, {}},
-        {u"__next__"_s, {}}
+    static const SlotFunctions result = {
+        {u"__str__"_s, {}}, {REPR_FUNCTION, {}},
+        {u"__iter__"_s, {}}, {u"__next__"_s, {}}
     };
-    m_nbFuncs = { {u"__abs__"_s, {}}, {u"__pow__"_s, {} }};
+    return result;
+}
+
+const CppGenerator::SlotFunctions &CppGenerator::nbSlotFunctions()
+{
+    static const SlotFunctions result = { {u"__abs__"_s, {}}, {u"__pow__"_s, {} }};
+    return result;
 }
 
 // Prevent ELF symbol qt_version_tag from being generated into the source
@@ -319,19 +375,24 @@ static const char includeQDebug[] =
 "#endif\n"
 "#include <QtCore/QDebug>\n";
 
+static QString compilerOptionOptimizeHelper()
+{
+    QString result;
+    const auto optimizations = CppGenerator::optimizations();
+    QTextStream str(&result);
+    str << "#define PYSIDE6_COMOPT_FULLNAME "
+        << (optimizations.testFlag(Generator::RemoveFullnameField) ? '1' : '0')
+        << "\n#define PYSIDE6_COMOPT_COMPRESS "
+        << (optimizations.testFlag(Generator::CompressSignatureStrings) ? '1' : '0')
+        << "\n// TODO: #define PYSIDE6_COMOPT_FOLDING "
+        << (optimizations.testFlag(Generator::FoldCommonTailCode) ? '1' : '0') << '\n';
+    str.flush();
+    return result;
+}
+
 static QString compilerOptionOptimize()
 {
-    static QString result;
-    if (result.isEmpty()) {
-        const auto optimizations = CppGenerator::optimizations();
-        QTextStream str(&result);
-        str << "#define PYSIDE6_COMOPT_FULLNAME "
-            << (optimizations.testFlag(Generator::RemoveFullnameField) ? '1' : '0')
-            << "\n#define PYSIDE6_COMOPT_COMPRESS "
-            << (optimizations.testFlag(Generator::CompressSignatureStrings) ? '1' : '0')
-            << "\n// TODO: #define PYSIDE6_COMOPT_FOLDING "
-            << (optimizations.testFlag(Generator::FoldCommonTailCode) ? '1' : '0') << '\n';
-    }
+    static const QString result = compilerOptionOptimizeHelper();
     return result;
 }
 
@@ -752,7 +813,7 @@ void CppGenerator::generateClass(TextStream &s, const GeneratorContext &classCon
                     << defEntries.constFirst() << outdent << ";\n\n";
             }
             const auto &fname = rfunc->name();
-            if (!m_tpFuncs.contains(fname) && !m_nbFuncs.contains(fname))
+            if (!tpSlotFunctions().contains(fname) && !nbSlotFunctions().contains(fname))
                 md << defEntries;
         }
     }
@@ -1304,7 +1365,7 @@ void CppGenerator::writeVirtualMethodNative(TextStream &s,
     s << "if (" << shibokenErrorsOccurred << ")\n" << indent
         << returnStatement.statement << '\n' << outdent;
 
-    s << "static PyObject *nameCache[2] = {};\n";
+    s << "static std::atomic<PyObject *> nameCache[2] = {};\n";
     writeFuncNameVar(s, func, funcName);
     s << "Shiboken::AutoDecRef " << PYTHON_OVERRIDE_VAR
         << "(Shiboken::BindingManager::instance().getOverride(this, nameCache, funcName));\n"
@@ -1700,19 +1761,16 @@ static void writePointerToPythonConverter(TextStream &c,
                                           const QString &typeName,
                                           const QString &cpythonType)
 {
-    c << "auto *pyOut = reinterpret_cast<PyObject *>(Shiboken::BindingManager::instance().retrieveWrapper(cppIn));\n"
-        << "if (pyOut) {\n" << indent
-        << "Py_INCREF(pyOut);\nreturn pyOut;\n" << outdent
-        << "}\n";
-
     const QString nameFunc = metaClass->typeEntry()->polymorphicNameFunction();
     if (nameFunc.isEmpty() && !metaClass->hasVirtualDestructor()) {
-        c << "return Shiboken::Object::newObjectWithHeuristics("
-            << cpythonType << ", const_cast<void *>(cppIn), false);\n";
+        c << "return Shiboken::Conversions::pointerToPythonWithHeuristics("
+            << cpythonType << ", cppIn);\n";
         return;
     }
 
-    c   << "auto *tCppIn = reinterpret_cast<const " << typeName << R"( *>(cppIn);
+    c << "if (auto *pyOut = Shiboken::Conversions::existingWrapper(cppIn))\n"
+        << indent << "return pyOut;\n" << outdent
+        << "auto *tCppIn = reinterpret_cast<const " << typeName << R"( *>(cppIn);
 const char *typeName = )";
     if (nameFunc.isEmpty())
         c << "typeid(*tCppIn).name();\n";
@@ -1756,8 +1814,8 @@ void CppGenerator::writeConverterFunctions(TextStream &s, const AbstractMetaClas
     writePythonToCppFunction(s, c.toString(), sourceTypeName, targetTypeName);
 
     // "Is convertible" function for the Python object to C++ pointer conversion.
-    const QString pyTypeCheck = u"PyObject_TypeCheck(pyIn, "_s + cpythonType + u")"_s;
-    writeIsPythonConvertibleToCppFunction(s, sourceTypeName, targetTypeName, pyTypeCheck, QString(), true);
+    writeIsPythonTypeConvertibleToCppFunction(s, sourceTypeName, targetTypeName,
+                                              u"checkPythonToCppPointer"_s, cpythonType);
     s << '\n';
 
     // C++ pointer to a Python wrapper, keeping identity.
@@ -1831,10 +1889,14 @@ void CppGenerator::writeConverterFunctions(TextStream &s, const AbstractMetaClas
     writePythonToCppFunction(s, c.toString(), sourceTypeName, targetTypeName);
 
     // "Is convertible" function for the Python object to C++ value copy conversion.
-    QString copyTypeCheck = pyTypeCheck;
-    if (classContext.forSmartPointer())
-        copyTypeCheck.prepend(pyInVariable + u" == Py_None || "_s);
-    writeIsPythonConvertibleToCppFunction(s, sourceTypeName, targetTypeName, copyTypeCheck);
+    if (classContext.forSmartPointer()) {
+        const QString copyTypeCheck = pyInVariable + u" == Py_None || PyObject_TypeCheck("_s
+                                      + pyInVariable + u", "_s + cpythonType + u')';
+        writeIsPythonConvertibleToCppFunction(s, sourceTypeName, targetTypeName, copyTypeCheck);
+    } else {
+        writeIsPythonTypeConvertibleToCppFunction(s, sourceTypeName, targetTypeName,
+                                                  u"checkPythonToCppCopy"_s, cpythonType);
+    }
     s << '\n';
 
     // User provided implicit conversions.
@@ -3010,6 +3072,44 @@ void CppGenerator::writeOverloadedFunctionDecisor(TextStream &s,
             << ";\n\n" << outdent;
 }
 
+// Returns the classes of the argument types of the children of an overload
+// decisor node if they are all plain wrapper types which do not accept
+// instances of each other (no implicit or custom conversions, no class
+// inheriting another one). An instance of exactly one of these types then
+// only passes the check of that type, so that the others can be skipped.
+AbstractMetaClassCList
+    CppGenerator::exactWrapperArgumentClasses(const OverloadDataList &children) const
+{
+    if (children.size() < 2)
+        return {};
+    AbstractMetaClassCList result;
+    for (const auto &child : children) {
+        if (child->isTypeModified())
+            return {};
+        const AbstractMetaType &argType = child->argType();
+        const auto typeEntry = argType.typeEntry();
+        if (argType.viewOn() != nullptr || argType.isSmartPointer()
+            || !(typeEntry->isObject() || typeEntry->isValue())
+            || argType.isObjectTypeUsedAsValueType() || argType.indirections() > 1
+            || !api().implicitConversions(typeEntry).isEmpty()) {
+            return {};
+        }
+        if (typeEntry->isValue()
+            && std::static_pointer_cast<const ValueTypeEntry>(typeEntry)->hasCustomConversion()) {
+            return {};
+        }
+        const auto metaClass = AbstractMetaClass::findClass(api().classes(), typeEntry);
+        if (!metaClass)
+            return {};
+        for (const auto &other : std::as_const(result)) {
+            if (inheritsFrom(metaClass, other) || inheritsFrom(other, metaClass))
+                return {};
+        }
+        result.append(metaClass);
+    }
+    return result;
+}
+
 void CppGenerator::writeOverloadedFunctionDecisorEngine(TextStream &s,
                                                         const OverloadData &overloadData,
                                                         const OverloadDataRootNode *node) const
@@ -3061,11 +3161,32 @@ void CppGenerator::writeOverloadedFunctionDecisorEngine(TextStream &s,
     }
 
     bool isFirst = true;
+    const OverloadDataList &children = node->children();
+
+    // For argument positions taking only wrapper types, look up the exact
+    // type of the argument in a table of them once to skip the checks of
+    // the types not matching.
+    QString exactTypeVar;
+    const AbstractMetaClassCList exactClasses = exactWrapperArgumentClasses(children);
+    if (!exactClasses.isEmpty()) {
+        const int argPos = children.constFirst()->argPos();
+        const QString pyArgName = (usePyArgs && maxArgs > 1) ? pythonArgsAt(argPos) : PYTHON_ARG;
+        const QString tableVar = "argTypes"_L1 + QString::number(argPos);
+        exactTypeVar = "exactType"_L1 + QString::number(argPos);
+        s << "PyTypeObject *const " << tableVar << "[] = {";
+        for (qsizetype i = 0, size = exactClasses.size(); i < size; ++i) {
+            if (i > 0)
+                s << ", ";
+            s << cpythonTypeNameExtSet(exactClasses.at(i)->typeEntry());
+        }
+        s << "};\nconst int " << exactTypeVar
+            << " = Shiboken::Conversions::exactTypeIndex(" << pyArgName << ", "
+            << tableVar << ");\n";
+    }
 
     // If the next argument has a default value the decisor can perform a method call;
     // it just need to check if the number of arguments received from Python are equal
     // to the number of parameters preceding the argument with the default value.
-    const OverloadDataList &children = node->children();
     if (hasDefaultCall) {
         isFirst = false;
         int numArgs = node->argPos() + 1;
@@ -3082,7 +3203,8 @@ void CppGenerator::writeOverloadedFunctionDecisorEngine(TextStream &s,
             << "; // " << func->minimalSignature() << '\n' << outdent << '}';
     }
 
-    for (auto child : children) {
+    for (qsizetype childIndex = 0; childIndex < children.size(); ++childIndex) {
+        auto child = children.at(childIndex);
         bool signatureFound = child->overloads().size() == 1
                                 && !child->getFunctionWithDefaultValue()
                                 && !child->findNextArgWithDefault();
@@ -3132,6 +3254,11 @@ void CppGenerator::writeOverloadedFunctionDecisorEngine(TextStream &s,
             }
         }
 
+        if (!exactTypeVar.isEmpty()) {
+            typeChecks.prepend(u'(' + exactTypeVar + " == -1 || "_L1 + exactTypeVar
+                               + " == "_L1 + QString::number(childIndex) + u')');
+        }
+
         if (usePyArgs && signatureFound) {
             AbstractMetaArgumentList args = refFunc->arguments();
             const bool isVarargs = args.size() > 1 && args.constLast().type().isVarargs();
@@ -3435,6 +3562,21 @@ void CppGenerator::writeIsPythonConvertibleToCppFunction(TextStream &s,
         << "return {};\n" << outdent << "}\n";
 }
 
+// Write a "Is convertible" function for the conversions of wrapped classes
+// delegating to an inline type check helper of libshiboken.
+void CppGenerator::writeIsPythonTypeConvertibleToCppFunction(TextStream &s,
+                                                             const QString &sourceTypeName,
+                                                             const QString &targetTypeName,
+                                                             const QString &checkFunction,
+                                                             const QString &cpythonType)
+{
+    s << "static PythonToCppFunc " << convertibleToCppFunctionName(sourceTypeName, targetTypeName)
+        << "(PyObject *pyIn)\n{\n" << indent
+        << "return Shiboken::Conversions::" << checkFunction << '(' << cpythonType
+        << ", pyIn, " << pythonToCppFunctionName(sourceTypeName, targetTypeName) << ");\n"
+        << outdent << "}\n";
+}
+
 void CppGenerator::writePythonToCppConversionFunctions(TextStream &s,
                                                        const AbstractMetaType &sourceType,
                                                        const AbstractMetaType &targetType,
@@ -4559,21 +4701,22 @@ void CppGenerator::writeClassDefinition(TextStream &s,
         tp_getset = cpythonGettersSettersDefinitionName(metaClass);
 
     // search for special functions
-    clearTpFuncs();
+    SlotFunctions tpFuncs = tpSlotFunctions();
+    SlotFunctions nbFuncs = nbSlotFunctions();
     for (const auto &func : metaClass->functions()) {
         // Special non-operator functions identified by name
-        auto it = m_tpFuncs.find(func->name());
-        if (it != m_tpFuncs.end())
+        auto it = tpFuncs.find(func->name());
+        if (it != tpFuncs.end())
             it.value() = cpythonFunctionName(func);
-        else if ( it = m_nbFuncs.find(func->name()); it !=  m_nbFuncs.end() )
+        else if ( it = nbFuncs.find(func->name()); it !=  nbFuncs.end() )
             it.value() = cpythonFunctionName(func);
     }
-    if (m_tpFuncs.value(REPR_FUNCTION).isEmpty()
+    if (tpFuncs.value(REPR_FUNCTION).isEmpty()
         && (isSmartPointer || metaClass->hasToStringCapability())) {
         const QString name = isSmartPointer
           ? writeSmartPointerReprFunction(s, classContext)
           : writeReprFunction(s, classContext, metaClass->toStringCapabilityIndirections());
-        m_tpFuncs[REPR_FUNCTION] = name;
+        tpFuncs[REPR_FUNCTION] = name;
     }
 
     // class or some ancestor has multiple inheritance
@@ -4603,17 +4746,17 @@ void CppGenerator::writeClassDefinition(TextStream &s,
         << "}\n\nstatic PyType_Slot " << className << "_slots[] = {\n" << indent
         << "{Py_tp_base,        nullptr}, // inserted by introduceWrapperType\n"
         << pyTypeSlotEntry("Py_tp_dealloc", tp_dealloc)
-      << pyTypeSlotEntry("Py_tp_repr", m_tpFuncs.value(REPR_FUNCTION))
+      << pyTypeSlotEntry("Py_tp_repr", tpFuncs.value(REPR_FUNCTION))
         << pyTypeSlotEntry("Py_tp_hash", tp_hash)
         << pyTypeSlotEntry("Py_tp_call", tp_call)
-        << pyTypeSlotEntry("Py_tp_str", m_tpFuncs.value(u"__str__"_s))
+        << pyTypeSlotEntry("Py_tp_str", tpFuncs.value(u"__str__"_s))
         << pyTypeSlotEntry("Py_tp_getattro", tp_getattro)
         << pyTypeSlotEntry("Py_tp_setattro", tp_setattro)
         << pyTypeSlotEntry("Py_tp_traverse", className + u"_traverse"_s)
         << pyTypeSlotEntry("Py_tp_clear", className + u"_clear"_s)
         << pyTypeSlotEntry("Py_tp_richcompare", tp_richcompare)
-        << pyTypeSlotEntry("Py_tp_iter", m_tpFuncs.value(u"__iter__"_s))
-        << pyTypeSlotEntry("Py_tp_iternext", m_tpFuncs.value(u"__next__"_s))
+        << pyTypeSlotEntry("Py_tp_iter", tpFuncs.value(u"__iter__"_s))
+        << pyTypeSlotEntry("Py_tp_iternext", tpFuncs.value(u"__next__"_s))
         << pyTypeSlotEntry("Py_tp_methods", className + u"_methods"_s)
         << pyTypeSlotEntry("Py_tp_getset", tp_getset)
         << pyTypeSlotEntry("Py_tp_init", tp_init)
@@ -4628,7 +4771,7 @@ void CppGenerator::writeClassDefinition(TextStream &s,
     }
     if (supportsNumberProtocol(metaClass)) {
         s << "// type supports number protocol\n";
-        writeTypeAsNumberDefinition(s, metaClass);
+        writeTypeAsNumberDefinition(s, metaClass, nbFuncs);
     }
     s << "{0, " << NULL_PTR << "}\n" << outdent << "};\n";
 
@@ -4796,7 +4939,9 @@ static const QHash<QString, QString> &nbFuncs()
     return result;
 }
 
-void CppGenerator::writeTypeAsNumberDefinition(TextStream &s, const AbstractMetaClassCPtr &metaClass) const
+void CppGenerator::writeTypeAsNumberDefinition(TextStream &s,
+                                               const AbstractMetaClassCPtr &metaClass,
+                                               const SlotFunctions &nbSlots) const
 {
     QMap<QString, QString> nb;
 
@@ -4807,7 +4952,7 @@ void CppGenerator::writeTypeAsNumberDefinition(TextStream &s, const AbstractMeta
         nb[opName] = cpythonFunctionName(rfunc);
     }
 
-    for (auto it = m_nbFuncs.cbegin(), end = m_nbFuncs.cend(); it != end; ++it) {
+    for (auto it = nbSlots.cbegin(), end = nbSlots.cend(); it != end; ++it) {
         if (!it.value().isEmpty())
             nb.insert(it.key(), it.value());
     }
@@ -6108,14 +6253,13 @@ void CppGenerator::writeGetattroDefinition(TextStream &s, const AbstractMetaClas
 
 QString CppGenerator::qObjectGetAttroFunction() const
 {
-    static QString result;
-    if (result.isEmpty()) {
+    static const QString result = [this] {
         auto qobjectClass = AbstractMetaClass::findClass(api().classes(), qObjectT);
         Q_ASSERT(qobjectClass);
-        result = u"PySide::getHiddenDataFromQObject("_s
-                 + cpythonWrapperCPtr(qobjectClass, PYTHON_SELF_VAR)
-                 + u", self, name)"_s;
-    }
+        return u"PySide::getHiddenDataFromQObject("_s
+               + cpythonWrapperCPtr(qobjectClass, PYTHON_SELF_VAR)
+               + u", self, name)"_s;
+    }();
     return result;
 }
 
@@ -6601,41 +6745,47 @@ bool CppGenerator::finishGeneration()
         << "_CONVERTERS_IDX_COUNT" << "];\n"
         << convertersVariableName() << " = sbkConverters;\n\n"
         << "PyObject *module = Shiboken::Module::create(\""  << moduleName()
-        << "\", &moduledef);\n\n"
-        << "// Make module available from global scope\n"
+        << "\", &moduledef);\n\n";
+    if (gilNotUsed())
+        s << "Shiboken::Module::setGilNotUsed(module);\n\n";
+    s << "// Make module available from global scope\n"
         << globalModuleVar << " = module;\n\n";
 
     const QString subModuleOf = typeDb->defaultTypeSystemType()->subModuleOf();
     if (!subModuleOf.isEmpty())
         writeSubModuleHandling(s,  moduleName(), subModuleOf);
 
-    s << "// Initialize classes in the type system\n"
+    // Classes, conversions and enumerations, registering the converter names
+    // counted for reserving the table of converters
+    StringStream initStream(TextStream::Language::Cpp);
+    initStream << "// Initialize classes in the type system\n"
         << s_classPythonDefines.toString();
 
     if (!typeConversions.isEmpty()) {
-        s << '\n';
+        initStream << '\n';
         for (const auto &conversion : typeConversions) {
-            writePrimitiveConverterInitialization(s, conversion);
-            s << '\n';
+            writePrimitiveConverterInitialization(initStream, conversion);
+            initStream << '\n';
         }
     }
 
     if (!containers.isEmpty()) {
-        s << '\n';
+        initStream << '\n';
         for (const AbstractMetaType &container : containers) {
-            const QString converterObj = writeContainerConverterInitialization(s, container, api());
+            const QString converterObj =
+                writeContainerConverterInitialization(initStream, container, api());
             const auto it = opaqueContainers.constFind(container);
             if (it !=  opaqueContainers.constEnd()) {
-                writeSetPythonToCppPointerConversion(s, converterObj,
+                writeSetPythonToCppPointerConversion(initStream, converterObj,
                                                      it.value().pythonToConverterFunctionName,
                                                      it.value().converterCheckFunctionName);
             }
-            s << '\n';
+            initStream << '\n';
         }
     }
 
     if (!opaqueContainers.isEmpty()) {
-        s << "\n// Opaque container type registration\n"
+        initStream << "\n// Opaque container type registration\n"
             << "PyObject *ob_type{};\n";
         if (usePySideExtensions()) {
             const bool hasQVariantConversion =
@@ -6643,27 +6793,27 @@ bool CppGenerator::finishGeneration()
                             [](const OpaqueContainerData &d) { return d.hasQVariantConversion; });
             if (hasQVariantConversion) {
                 const char qVariantConverterVar[] = "qVariantConverter";
-                s << "auto *" << qVariantConverterVar
-                  << " = Shiboken::Conversions::getConverter(\"QVariant\");\n"
-                  << "Q_ASSERT(" << qVariantConverterVar << " != nullptr);\n";
+                initStream << "auto *" << qVariantConverterVar
+                    << " = Shiboken::Conversions::getConverter(\"QVariant\");\n"
+                    << "Q_ASSERT(" << qVariantConverterVar << " != nullptr);\n";
             }
         }
         for (const auto &d : opaqueContainers)
-            s << d.registrationCode;
-        s << '\n';
+            initStream << d.registrationCode;
+        initStream << '\n';
     }
 
     if (!extendedConverters.isEmpty()) {
-        s << '\n';
+        initStream << '\n';
         for (ExtendedConverterData::const_iterator it = extendedConverters.cbegin(), end = extendedConverters.cend(); it != end; ++it) {
-            writeExtendedConverterInitialization(s, it.key(), it.value());
-            s << '\n';
+            writeExtendedConverterInitialization(initStream, it.key(), it.value());
+            initStream << '\n';
         }
     }
 
-    writeEnumsInitialization(s, globalEnums);
+    writeEnumsInitialization(initStream, globalEnums);
 
-    s << "// Register primitive types converters.\n";
+    initStream << "// Register primitive types converters.\n";
     const PrimitiveTypeEntryCList &primitiveTypeList = primitiveTypes();
     for (const auto &pte : primitiveTypeList) {
         if (!pte->generateCode() || !isCppPrimitive(pte))
@@ -6671,11 +6821,16 @@ bool CppGenerator::finishGeneration()
         if (!pte->referencesType())
             continue;
         TypeEntryCPtr referencedType = basicReferencedTypeEntry(pte);
-        s << registerConverterName(pte->qualifiedCppName(), converterObject(referencedType),
-                                   registerConverterName::Alias
-                                   | registerConverterName::PartiallyQualifiedAliases);
+        initStream << registerConverterName(pte->qualifiedCppName(),
+                                            converterObject(referencedType),
+                                            registerConverterName::Alias
+                                            | registerConverterName::PartiallyQualifiedAliases);
     }
 
+    s << "Shiboken::Conversions::reserveConverterNames("
+        << registerConverterName::nameCount() << ");\n\n"
+        << initStream.toString();
+
     s << '\n';
     if (maxTypeIndex)
         s << "Shiboken::Module::registerTypes(module, " << cppApiVariableName() << ");\n";
@@ -56,6 +56,8 @@ private:
         bool needsReference = false;
     };
 
+    // Python special function name -> C++ wrapper function (type/number slots)
+    using SlotFunctions = QHash<QString, QString>;
 
     void generateSmartPointerClass(TextStream &s, const GeneratorContext &classContext);
     void generateIncludes(TextStream &s, const GeneratorContext &classContext,
@@ -295,6 +297,7 @@ private:
     void writeOverloadedFunctionDecisorEngine(TextStream &s,
                                               const OverloadData &overloadData,
                                               const OverloadDataRootNode *node) const;
+    AbstractMetaClassCList exactWrapperArgumentClasses(const OverloadDataList &children) const;
 
     /// Writes calls to all the possible method/function overloads.
     void writeFunctionCalls(TextStream &s,
@@ -343,6 +346,11 @@ private:
                                                        const QString &condition,
                                                        QString pythonToCppFuncName = QString(),
                                                        bool acceptNoneAsCppNull = false);
+    static void writeIsPythonTypeConvertibleToCppFunction(TextStream &s,
+                                                          const QString &sourceTypeName,
+                                                          const QString &targetTypeName,
+                                                          const QString &checkFunction,
+                                                          const QString &cpythonType);
 
     /// Writes a pair of Python to C++ conversion and check functions.
     void writePythonToCppConversionFunctions(TextStream &s,
@@ -434,7 +442,9 @@ private:
                              const AbstractMetaClassCPtr &metaClass,
                              const GeneratorContext &context) const;
 
-    void writeTypeAsNumberDefinition(TextStream &s, const AbstractMetaClassCPtr &metaClass) const;
+    void writeTypeAsNumberDefinition(TextStream &s,
+                                     const AbstractMetaClassCPtr &metaClass,
+                                     const SlotFunctions &nbSlots) const;
 
     static void writeTpTraverseFunction(TextStream &s, const AbstractMetaClassCPtr &metaClass);
     static void writeTpClearFunction(TextStream &s, const AbstractMetaClassCPtr &metaClass);
@@ -557,13 +567,11 @@ private:
     static bool hasBoolCast(const AbstractMetaClassCPtr &metaClass)
     { return boolCast(metaClass).has_value(); }
 
-    void clearTpFuncs();
+    static const SlotFunctions &tpSlotFunctions();
+    static const SlotFunctions &nbSlotFunctions();
     static QString chopType(QString s);
 
     static QString typeInitStructHelper(const TypeEntryCPtr &te, const QString &varName);
-
-    QHash<QString, QString> m_tpFuncs;
-    QHash<QString, QString> m_nbFuncs;
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS(CppGenerator::CppSelfDefinitionFlags)
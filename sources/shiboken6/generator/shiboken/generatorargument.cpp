@@ -7,6 +7,7 @@
 #include <typesystem.h>
 
 #include <QtCore/QDebug>
+#include <QtCore/QMutex>
 #include <QtCore/QSet>
 
 static bool isCppPrimitiveString(const AbstractMetaType &type)
@@ -46,7 +47,9 @@ GeneratorArgument GeneratorArgument::fromMetaType(const AbstractMetaType &type)
                 result.type = Type::CppPrimitiveArray;
             } else {
                 static QSet<QString> warnedTypes;
-                const QString &signature = type.cppSignature();
+                static QMutex warnedTypesMutex;
+                const QString signature = type.cppSignature();
+                QMutexLocker locker(&warnedTypesMutex);
                 if (!warnedTypes.contains(signature)) {
                     warnedTypes.insert(signature);
                     qWarning("%s", qPrintable(msgUnknownArrayPointerConversion(signature)));
@@ -24,7 +24,7 @@ constexpr auto CONV_RULE_OUT_VAR_SUFFIX = QLatin1StringView("_out");
 constexpr auto BEGIN_ALLOW_THREADS
     = QLatin1StringView("PyThreadState *_save = PyEval_SaveThread(); // Py_BEGIN_ALLOW_THREADS");
 constexpr auto END_ALLOW_THREADS
-    = QLatin1StringView("PyEval_RestoreThread(_save); // Py_END_ALLOW_THREADS");
+    = QLatin1StringView("Shiboken::GilState::restoreThread(_save); // Py_END_ALLOW_THREADS");
 
 constexpr auto REPR_FUNCTION = QLatin1StringView("__repr__");
 
@@ -43,11 +43,13 @@
 
 #include <QtCore/QDir>
 #include <QtCore/QDebug>
+#include <QtCore/QMutex>
 #include <QtCore/QRegularExpression>
 
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 
 using namespace Qt::StringLiterals;
@@ -63,6 +65,7 @@ static constexpr auto USE_OPERATOR_BOOL_AS_NB_NONZERO = "use-operator-bool-as-nb
 static constexpr auto WRAPPER_DIAGNOSTICS = "wrapper-diagnostics"_L1;
 static constexpr auto NO_IMPLICIT_CONVERSIONS = "no-implicit-conversions"_L1;
 static constexpr auto LEAN_HEADERS = "lean-headers"_L1;
+static constexpr auto GIL_NOT_USED = "gil-not-used"_L1;
 
 QString CPP_ARG_N(int i)
 {
@@ -100,6 +103,7 @@ struct ShibokenGeneratorOptions
     // FIXME PYSIDE 7 Flip generateImplicitConversions default or remove?
     bool generateImplicitConversions = true;
     bool wrapperDiagnostics = false;
+    bool gilNotUsed = false;
 };
 
 struct GeneratorClassInfoCacheEntry
@@ -110,9 +114,14 @@ struct GeneratorClassInfoCacheEntry
     bool needsGetattroFunction = false;
 };
 
-using GeneratorClassInfoCache = QHash<AbstractMetaClassCPtr, GeneratorClassInfoCacheEntry>;
+// Node based, so that references to the entries remain valid when other
+// threads insert entries.
+using GeneratorClassInfoCache =
+    std::unordered_map<AbstractMetaClassCPtr, GeneratorClassInfoCacheEntry>;
 
 Q_GLOBAL_STATIC(GeneratorClassInfoCache, generatorClassInfoCache)
+// Guards the cache, the classes may be generated in several threads
+static QMutex generatorClassInfoCacheMutex;
 
 static const char CHECKTYPE_REGEX[] = R"(%CHECKTYPE\[([^\[]*)\]\()";
 static const char ISCONVERTIBLE_REGEX[] = R"(%ISCONVERTIBLE\[([^\[]*)\]\()";
@@ -2048,16 +2057,22 @@ const GeneratorClassInfoCacheEntry &
     ShibokenGenerator::getGeneratorClassInfo(const AbstractMetaClassCPtr &scope)
 {
     auto *cache = generatorClassInfoCache();
-    auto it = cache->find(scope);
-    if (it == cache->end()) {
-        it = cache->insert(scope, {});
-        auto &entry = it.value();
-        entry.functionGroups = getFunctionGroupsImpl(scope);
-        entry.needsGetattroFunction = classNeedsGetattroFunctionImpl(scope);
-        entry.numberProtocolOperators = getNumberProtocolOperators(scope);
-        entry.boolCastFunctionO = getBoolCast(scope);
+    {
+        QMutexLocker locker(&generatorClassInfoCacheMutex);
+        auto it = cache->find(scope);
+        if (it != cache->end())
+            return it->second;
     }
-    return it.value();
+
+    // Compute outside the lock, the functions query other classes
+    GeneratorClassInfoCacheEntry entry;
+    entry.functionGroups = getFunctionGroupsImpl(scope);
+    entry.needsGetattroFunction = classNeedsGetattroFunctionImpl(scope);
+    entry.numberProtocolOperators = getNumberProtocolOperators(scope);
+    entry.boolCastFunctionO = getBoolCast(scope);
+
+    QMutexLocker locker(&generatorClassInfoCacheMutex);
+    return cache->try_emplace(scope, std::move(entry)).first->second;
 }
 
 ShibokenGenerator::FunctionGroups
@@ -2366,7 +2381,10 @@ QList<OptionDescription> ShibokenGenerator::options()
         {NO_IMPLICIT_CONVERSIONS,
          u"Do not generate implicit_conversions for function arguments."_s},
         {WRAPPER_DIAGNOSTICS,
-         u"Generate diagnostic code around wrappers"_s}
+         u"Generate diagnostic code around wrappers"_s},
+        {GIL_NOT_USED,
+         u"Declare that the module does not need the GIL in free-threaded\n"
+          "builds of Python (Py_MOD_GIL_NOT_USED)"_s}
     };
 }
 
@@ -2405,6 +2423,8 @@ bool ShibokenGeneratorOptionsParser::handleBoolOption(const QString &key, Option
     }
     if (key == WRAPPER_DIAGNOSTICS)
         return (m_options->wrapperDiagnostics = true);
+    if (key == GIL_NOT_USED)
+        return (m_options->gilNotUsed = true);
     return false;
 }
 
@@ -2438,6 +2458,11 @@ bool ShibokenGenerator::leanHeaders()
     return m_options.leanHeaders;
 }
 
+bool ShibokenGenerator::gilNotUsed()
+{
+    return m_options.gilNotUsed;
+}
+
 bool ShibokenGenerator::useOperatorBoolAsNbBool()
 {
     return m_options.useOperatorBoolAsNbBool;
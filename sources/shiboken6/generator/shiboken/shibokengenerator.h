@@ -100,6 +100,8 @@ public:
 protected:
     bool doSetup() override;
 
+    bool canGenerateClassesInParallel() const override { return true; }
+
     GeneratorContext contextForClass(const AbstractMetaClassCPtr &c) const override;
 
     /**
@@ -310,6 +312,8 @@ protected:
     static bool useIsNullAsNbBool();
     /// Whether to generate lean module headers
     static bool leanHeaders();
+    /// Whether the module declares that it does not need the GIL
+    static bool gilNotUsed();
     /// Returns true if the generator should use operator bool to compute boolean casts.
     static bool useOperatorBoolAsNbBool();
     /// Generate implicit conversions of function arguments
@@ -321,7 +321,7 @@ SbkObject *BindingManager::retrieveWrapper(const void *cptr)
 }
 
 PyObject *BindingManager::getOverride(const void *cptr,
-                                      PyObject *nameCache[],
+                                      std::atomic<PyObject *> nameCache[],
                                       const char *methodName)
 {
     SbkObject *wrapper = retrieveWrapper(cptr);
@@ -336,22 +336,34 @@ PyObject *BindingManager::getOverride(const void *cptr,
     int flag = currentSelectId(Py_TYPE(wrapper));
     int propFlag = isdigit(methodName[0]) ? methodName[0] - '0' : 0;
     bool is_snake = flag & 0x01;
-    PyObject *pyMethodName = nameCache[is_snake];  // borrowed
+    // The cache is shared by all threads. The names are interned strings,
+    // concurrent initializations store the same object.
+    PyObject *pyMethodName = nameCache[is_snake].load(std::memory_order_acquire);  // borrowed
     if (pyMethodName == nullptr) {
         if (propFlag)
             methodName += 2;    // skip the propFlag and ':'
         pyMethodName = Shiboken::String::getSnakeCaseName(methodName, is_snake);
-        nameCache[is_snake] = pyMethodName;
+        nameCache[is_snake].store(pyMethodName, std::memory_order_release);
     }
 
     auto *obWrapper = reinterpret_cast<PyObject *>(wrapper);
     auto *wrapper_dict = SbkObject_GetDict_NoRef(obWrapper);
+    // Note: This special case was implemented for duck-punching, which happens
+    // in the instance dict. It does not work with properties.
+#ifdef Py_GIL_DISABLED
+    // Another thread may replace the entry, a borrowed reference is not safe.
+    PyObject *instanceMethod{};
+    const int found = PyDict_GetItemRef(wrapper_dict, pyMethodName, &instanceMethod);
+    if (found > 0)
+        return instanceMethod;
+    if (found < 0)
+        PyErr_Clear();
+#else
     if (PyObject *method = PyDict_GetItem(wrapper_dict, pyMethodName)) {
-        // Note: This special case was implemented for duck-punching, which happens
-        // in the instance dict. It does not work with properties.
         Py_INCREF(method);
         return method;
     }
+#endif
 
     PyObject *method = PyObject_GetAttr(reinterpret_cast<PyObject *>(wrapper), pyMethodName);
 
@@ -7,6 +7,7 @@
 #include "sbkpython.h"
 #include "shibokenmacros.h"
 
+#include <atomic>
 #include <set>
 #include <utility>
 
@@ -42,7 +43,8 @@ public:
     void addToDeletionInMainThread(const DestructorEntry &);
 
     SbkObject *retrieveWrapper(const void *cptr);
-    PyObject *getOverride(const void *cptr, PyObject *nameCache[], const char *methodName);
+    PyObject *getOverride(const void *cptr, std::atomic<PyObject *> nameCache[],
+                          const char *methodName);
 
     void addClassInheritance(Module::TypeInitStruct *parent, Module::TypeInitStruct *child);
     /// Try to find the correct type of cptr via type discovery knowing that it's at least
@@ -3,15 +3,116 @@
 
 #include "gilstate.h"
 
+#include <vector>
+
 namespace Shiboken
 {
 
-GilState::GilState()
+static bool isFinalizing()
+{
+#if defined(Py_LIMITED_API)
+    return false;
+#elif PY_VERSION_HEX >= 0x030D0000
+    return Py_IsFinalizing() != 0;
+#else
+    return _Py_IsFinalizing() != 0;
+#endif
+}
+
+#ifndef Py_LIMITED_API
+// The thread state attached to the current thread, nullptr if the thread
+// does not hold the GIL.
+static inline PyThreadState *attachedThreadState()
+{
+#  if PY_VERSION_HEX >= 0x030D0000
+    return PyThreadState_GetUnchecked();
+#  else
+    return _PyThreadState_UncheckedGet();
+#  endif
+}
+#endif
+
+// Per-thread data of GilState.
+//
+// For threads not created by Python (QThreadPool workers, render threads,
+// etc.), PyGILState_Ensure() creates a thread state which PyGILState_Release()
+// deletes again when the nesting count drops to 0. Pin the thread state by an
+// additional PyGILState_Ensure() and drop it when the thread exits, so that
+// callbacks only need to restore it.
+//
+// The GIL kept by deferRelease() is recorded along with the nesting level of
+// GilState instances. It is only held while returning to the code calling the
+// callbacks (typically the event loop); when that code enters Python again,
+// the nesting level increases and the GIL is not released from there.
+class GilThreadData
 {
-    if (Py_IsInitialized()) {
-        m_gstate = PyGILState_Ensure();
-        m_locked = true;
+public:
+    GilThreadData(const GilThreadData &) = delete;
+    GilThreadData(GilThreadData &&) = delete;
+    GilThreadData &operator=(const GilThreadData &) = delete;
+    GilThreadData &operator=(GilThreadData &&) = delete;
+
+    GilThreadData() = default;
+    ~GilThreadData();
+
+    // Called with the GIL held by a thread for which PyGILState_Ensure()
+    // has just created the thread state.
+    void pin()
+    {
+        PyGILState_Ensure();
+        m_pinned = true;
     }
+
+    void releaseDeferred(int level);
+
+    int level = 0;
+    std::vector<int> deferredLevels;
+
+private:
+    bool m_pinned = false;
+};
+
+void GilThreadData::releaseDeferred(int level)
+{
+    while (!deferredLevels.empty() && deferredLevels.back() >= level) {
+        deferredLevels.pop_back();
+        PyGILState_Release(PyGILState_UNLOCKED);
+    }
+}
+
+GilThreadData::~GilThreadData()
+{
+    // The thread state is cleared along with the interpreter if the thread
+    // outlives it.
+    if (!Py_IsInitialized() || isFinalizing())
+        return;
+    releaseDeferred(0);
+    if (m_pinned) {
+        PyGILState_Ensure();
+        PyGILState_Release(PyGILState_LOCKED);
+        PyGILState_Release(PyGILState_UNLOCKED); // Deletes the thread state, releases the GIL
+    }
+}
+
+static thread_local GilThreadData gilThreadData;
+
+GilState::GilState()
+{
+    if (!Py_IsInitialized())
+        return;
+    ++gilThreadData.level;
+    m_nested = true;
+#ifndef Py_LIMITED_API
+    // Fast path: Called from Python. PyGILState_Check() cannot be used since
+    // it always succeeds when the GIL state checks are disabled (subinterpreters).
+    if (attachedThreadState() != nullptr)
+        return;
+#endif
+    const bool newThreadState = PyGILState_GetThisThreadState() == nullptr;
+    m_gstate = PyGILState_Ensure();
+    m_locked = true;
+    if (newThreadState)
+        gilThreadData.pin();
 }
 
 GilState::~GilState()
@@ -21,6 +122,10 @@ GilState::~GilState()
 
 void GilState::release()
 {
+    if (m_nested) {
+        --gilThreadData.level;
+        m_nested = false;
+    }
     if (m_locked && Py_IsInitialized()) {
         PyGILState_Release(m_gstate);
         m_locked = false;
@@ -34,5 +139,46 @@ void GilState::abandon()
     m_locked = false;
 }
 
-} // namespace Shiboken
+void GilState::deferRelease()
+{
+#ifdef Py_GIL_DISABLED
+    // There is no GIL to keep and an attached thread state would block
+    // the garbage collector from stopping the world.
+    release();
+#else
+    // Only an instance that acquired the GIL can keep it, nested instances
+    // (PyGILState_LOCKED) do not release it anyways.
+    if (!m_locked || m_gstate != PyGILState_UNLOCKED || !Py_IsInitialized()) {
+        release();
+        return;
+    }
+    m_locked = false;
+    release();
+    gilThreadData.deferredLevels.push_back(gilThreadData.level);
+#endif
+}
 
+int GilState::nestingLevel()
+{
+    return gilThreadData.level;
+}
+
+bool GilState::hasDeferredRelease()
+{
+    return !gilThreadData.deferredLevels.empty()
+        && gilThreadData.deferredLevels.back() >= gilThreadData.level;
+}
+
+void GilState::releaseDeferred()
+{
+    if (Py_IsInitialized())
+        gilThreadData.releaseDeferred(gilThreadData.level);
+}
+
+void GilState::restoreThread(PyThreadState *threadState)
+{
+    releaseDeferred();
+    PyEval_RestoreThread(threadState);
+}
+
+} // namespace Shiboken
@@ -22,9 +22,25 @@ public:
     ~GilState();
     void release();
     void abandon();
+
+    /// Release the instance, but keep the GIL acquired by it until
+    /// releaseDeferred() is called on the same nesting level. This allows for
+    /// running a batch of callbacks from an event loop under one acquisition.
+    void deferRelease();
+
+    /// Nesting level of GilState instances of the current thread.
+    static int nestingLevel();
+    static bool hasDeferredRelease();
+    /// Release a GIL kept by deferRelease() on the current nesting level.
+    static void releaseDeferred();
+    /// Restore a thread state saved by PyEval_SaveThread() (replacement for
+    /// Py_END_ALLOW_THREADS), releasing a GIL kept by deferRelease() first.
+    static void restoreThread(PyThreadState *threadState);
+
 private:
     PyGILState_STATE m_gstate;
     bool m_locked = false;
+    bool m_nested = false;
 };
 
 } // namespace Shiboken
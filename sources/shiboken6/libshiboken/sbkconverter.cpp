@@ -10,6 +10,7 @@
 #include "autodecref.h"
 #include "helper.h"
 #include "voidptr.h"
+#include "sbkmutex.h"
 
 #include <string>
 #include <cstring>
@@ -17,12 +18,37 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <map>
+#include <mutex>
 #include <set>
 
 static SbkConverter **PrimitiveTypeConverters;
 
-using ConvertersMap = std::unordered_map<std::string, SbkConverter *>;
+// Key of the table of converters, which stores the hash of the name so that
+// registerConverterNames() can pass in the hashes computed by the generator.
+struct ConverterKey
+{
+    explicit ConverterKey(std::string n) :
+        hash(std::size_t(Shiboken::Conversions::converterNameHash(n))), name(std::move(n)) {}
+    ConverterKey(std::uint64_t h, const char *n) : hash(std::size_t(h)), name(n) {}
+
+    bool operator==(const ConverterKey &rhs) const
+    {
+        return hash == rhs.hash && name == rhs.name;
+    }
+
+    std::size_t hash;
+    std::string name;
+};
+
+struct ConverterKeyHash
+{
+    std::size_t operator()(const ConverterKey &key) const noexcept { return key.hash; }
+};
+
+using ConvertersMap = std::unordered_map<ConverterKey, SbkConverter *, ConverterKeyHash>;
 static ConvertersMap converters;
+// Protects the converters and the negative lookup cache (free-threaded build).
+static Shiboken::Mutex convertersMutex;
 
 namespace Shiboken::Conversions {
 
@@ -54,25 +80,25 @@ void init()
     PrimitiveTypeConverters = primitiveTypeConverters;
 
     assert(converters.empty());
-    converters["PY_LONG_LONG"] = primitiveTypeConverters[SBK_PY_LONG_LONG_IDX];
-    converters["bool"] = primitiveTypeConverters[SBK_BOOL_IDX_1];
-    converters["char"] = primitiveTypeConverters[SBK_CHAR_IDX];
-    converters["const char *"] = primitiveTypeConverters[SBK_CONSTCHARPTR_IDX];
-    converters["double"] = primitiveTypeConverters[SBK_DOUBLE_IDX];
-    converters["float"] = primitiveTypeConverters[SBK_FLOAT_IDX];
-    converters["int"] = primitiveTypeConverters[SBK_INT_IDX];
-    converters["long"] = primitiveTypeConverters[SBK_LONG_IDX];
-    converters["short"] = primitiveTypeConverters[SBK_SHORT_IDX];
-    converters["signed char"] = primitiveTypeConverters[SBK_SIGNEDCHAR_IDX];
-    converters["std::string"] = primitiveTypeConverters[SBK_STD_STRING_IDX];
-    converters["std::wstring"] = primitiveTypeConverters[SBK_STD_WSTRING_IDX];
-    converters["unsigned PY_LONG_LONG"] = primitiveTypeConverters[SBK_UNSIGNEDPY_LONG_LONG_IDX];
-    converters["unsigned char"] = primitiveTypeConverters[SBK_UNSIGNEDCHAR_IDX];
-    converters["unsigned int"] = primitiveTypeConverters[SBK_UNSIGNEDINT_IDX];
-    converters["unsigned long"] = primitiveTypeConverters[SBK_UNSIGNEDLONG_IDX];
-    converters["unsigned short"] = primitiveTypeConverters[SBK_UNSIGNEDSHORT_IDX];
-    converters["void*"] = primitiveTypeConverters[SBK_VOIDPTR_IDX];
-    converters["std::nullptr_t"] = primitiveTypeConverters[SBK_NULLPTR_T_IDX];
+    converters[ConverterKey("PY_LONG_LONG")] = primitiveTypeConverters[SBK_PY_LONG_LONG_IDX];
+    converters[ConverterKey("bool")] = primitiveTypeConverters[SBK_BOOL_IDX_1];
+    converters[ConverterKey("char")] = primitiveTypeConverters[SBK_CHAR_IDX];
+    converters[ConverterKey("const char *")] = primitiveTypeConverters[SBK_CONSTCHARPTR_IDX];
+    converters[ConverterKey("double")] = primitiveTypeConverters[SBK_DOUBLE_IDX];
+    converters[ConverterKey("float")] = primitiveTypeConverters[SBK_FLOAT_IDX];
+    converters[ConverterKey("int")] = primitiveTypeConverters[SBK_INT_IDX];
+    converters[ConverterKey("long")] = primitiveTypeConverters[SBK_LONG_IDX];
+    converters[ConverterKey("short")] = primitiveTypeConverters[SBK_SHORT_IDX];
+    converters[ConverterKey("signed char")] = primitiveTypeConverters[SBK_SIGNEDCHAR_IDX];
+    converters[ConverterKey("std::string")] = primitiveTypeConverters[SBK_STD_STRING_IDX];
+    converters[ConverterKey("std::wstring")] = primitiveTypeConverters[SBK_STD_WSTRING_IDX];
+    converters[ConverterKey("unsigned PY_LONG_LONG")] = primitiveTypeConverters[SBK_UNSIGNEDPY_LONG_LONG_IDX];
+    converters[ConverterKey("unsigned char")] = primitiveTypeConverters[SBK_UNSIGNEDCHAR_IDX];
+    converters[ConverterKey("unsigned int")] = primitiveTypeConverters[SBK_UNSIGNEDINT_IDX];
+    converters[ConverterKey("unsigned long")] = primitiveTypeConverters[SBK_UNSIGNEDLONG_IDX];
+    converters[ConverterKey("unsigned short")] = primitiveTypeConverters[SBK_UNSIGNEDSHORT_IDX];
+    converters[ConverterKey("void*")] = primitiveTypeConverters[SBK_VOIDPTR_IDX];
+    converters[ConverterKey("std::nullptr_t")] = primitiveTypeConverters[SBK_NULLPTR_T_IDX];
 
     initArrayConverters();
 }
@@ -135,10 +161,11 @@ void dumpConverters()
 
     // Sort the entries by the associated PyTypeObjects and converters
     PyTypeObjectConverterMap pyTypeObjectConverterMap;
+    std::lock_guard<Shiboken::Mutex> guard(convertersMutex);
     for (const auto &converter : converters) {
         auto *sbkConverter = converter.second;
         if (sbkConverter == nullptr) {
-            str << "Non-existent: \"" << converter.first << "\"\n";
+            str << "Non-existent: \"" << converter.first.name << "\"\n";
             continue;
         }
         auto *typeObject = sbkConverter->pythonType;
@@ -151,7 +178,7 @@ void dumpConverters()
         if (convIt == sbkConverterMap.end())
             convIt = sbkConverterMap.insert(std::make_pair(sbkConverter,
                                                            StringSet{})).first;
-        convIt->second.insert(converter.first);
+        convIt->second.insert(converter.first.name);
     }
 
      for (const auto &tc : pyTypeObjectConverterMap) {
@@ -283,6 +310,20 @@ PyObject *pointerToPython(const SbkConverter *converter, const void *cppIn)
     return converter->pointerToPython(cppIn);
 }
 
+PyObject *existingWrapper(const void *cppIn)
+{
+    auto *pyOut = reinterpret_cast<PyObject *>(BindingManager::instance().retrieveWrapper(cppIn));
+    Py_XINCREF(pyOut);
+    return pyOut;
+}
+
+PyObject *pointerToPythonWithHeuristics(PyTypeObject *type, const void *cppIn)
+{
+    if (PyObject *pyOut = existingWrapper(cppIn))
+        return pyOut;
+    return Object::newObjectWithHeuristics(type, const_cast<void *>(cppIn), false);
+}
+
 PyObject *referenceToPython(PyTypeObject *type, const void *cppIn)
 {
     auto *sotp = PepType_SOTP(type);
@@ -329,11 +370,24 @@ PyObject *copyToPython(const SbkConverter *converter, const void *cppIn)
     return CopyCppToPython(converter, cppIn);
 }
 
+// Python to C++ pointer conversion of a wrapper type. Instances of exactly
+// the type are accepted by the generated check function, so it is skipped
+// for them. This is the common case when resolving overloads.
+static inline PythonToCppFunc IsPythonToCppPointerConvertible(const SbkConverter *converter,
+                                                              PyTypeObject *type,
+                                                              PyObject *pyIn)
+{
+    const auto &pointerConversion = converter->toCppPointerConversion;
+    if (Py_TYPE(pyIn) == type && pointerConversion.second != nullptr)
+        return pointerConversion.second;
+    return pointerConversion.first(pyIn);
+}
+
 PythonToCppFunc isPythonToCppPointerConvertible(PyTypeObject *type, PyObject *pyIn)
 {
     assert(pyIn);
     auto *sotp = PepType_SOTP(type);
-    return sotp->converter->toCppPointerConversion.first(pyIn);
+    return IsPythonToCppPointerConvertible(sotp->converter, type, pyIn);
 }
 
 PythonToCppConversion pythonToCppPointerConversion(PyTypeObject *type, PyObject *pyIn)
@@ -421,23 +475,27 @@ LIBSHIBOKEN_API PythonToCppConversion pythonToCppConversion(const SbkArrayConver
 
 PythonToCppFunc isPythonToCppReferenceConvertible(PyTypeObject *type, PyObject *pyIn)
 {
+    const SbkConverter *converter = PepType_SOTP(type)->converter;
     if (pyIn != Py_None) {
-        PythonToCppFunc toCpp = isPythonToCppPointerConvertible(type, pyIn);
+        PythonToCppFunc toCpp = IsPythonToCppPointerConvertible(converter, type, pyIn);
         if (toCpp)
             return toCpp;
     }
-    return isPythonToCppValueConvertible(type, pyIn);
+    return IsPythonToCppConvertible(converter, pyIn);
 }
 
 PythonToCppConversion pythonToCppReferenceConversion(PyTypeObject *type, PyObject *pyIn)
 {
     if (pyIn == nullptr)
         return {};
+    // Look up the converter only once; PepType_SOTP() is a hash lookup
+    // in builds using the limited API before Python 3.12.
+    const SbkConverter *converter = PepType_SOTP(type)->converter;
     if (pyIn != Py_None) {
-        if (PythonToCppFunc toCppPtr = isPythonToCppPointerConvertible(type, pyIn))
+        if (PythonToCppFunc toCppPtr = IsPythonToCppPointerConvertible(converter, type, pyIn))
             return {toCppPtr, PythonToCppConversion::Pointer};
     }
-    if (PythonToCppFunc toCppVal = isPythonToCppValueConvertible(type, pyIn))
+    if (PythonToCppFunc toCppVal = IsPythonToCppConvertible(converter, pyIn))
         return {toCppVal, PythonToCppConversion::Value};
     return {};
 }
@@ -527,18 +585,31 @@ bool isImplicitConversion(PyTypeObject *type, PythonToCppFunc toCppFunc)
 
 void registerConverterName(SbkConverter *converter, const char *typeName)
 {
-    auto iter = converters.find(typeName);
-    if (iter == converters.end())
-        converters.insert(std::make_pair(typeName, converter));
-    else
-        iter->second = converter;
+    std::lock_guard<Shiboken::Mutex> guard(convertersMutex);
+    converters.insert_or_assign(ConverterKey(typeName), converter);
 }
 
 void registerConverterAlias(SbkConverter *converter, const char *typeName)
 {
-    auto iter = converters.find(typeName);
-    if (iter == converters.end())
-        converters.insert(std::make_pair(typeName, converter));
+    std::lock_guard<Shiboken::Mutex> guard(convertersMutex);
+    converters.try_emplace(ConverterKey(typeName), converter);
+}
+
+void registerConverterNames(SbkConverter *converter,
+                            std::initializer_list<ConverterName> typeNames,
+                            std::initializer_list<ConverterName> aliases)
+{
+    std::lock_guard<Shiboken::Mutex> guard(convertersMutex);
+    for (const auto &typeName : typeNames)
+        converters.insert_or_assign(ConverterKey(typeName.hash, typeName.name), converter);
+    for (const auto &typeName : aliases)
+        converters.try_emplace(ConverterKey(typeName.hash, typeName.name), converter);
+}
+
+void reserveConverterNames(std::size_t count)
+{
+    std::lock_guard<Shiboken::Mutex> guard(convertersMutex);
+    converters.reserve(converters.size() + count);
 }
 
 static std::string getRealTypeName(const std::string &typeName)
@@ -558,29 +629,49 @@ static std::unordered_set<std::string> nonExistingTypeNames{};
 // Arbitrary size limit to prevent random name overflows.
 static constexpr std::size_t negativeCacheLimit = 50;
 
+static void clearNegativeLazyCacheHelper()
+{
+    for (const auto &typeName : nonExistingTypeNames)
+        converters.erase(ConverterKey(typeName));
+    nonExistingTypeNames.clear();
+}
+
 static void rememberAsNonexistent(const std::string &typeName)
 {
     if (nonExistingTypeNames.size() > negativeCacheLimit)
-        clearNegativeLazyCache();
-    converters.insert(std::make_pair(typeName, nullptr));
+        clearNegativeLazyCacheHelper();
+    converters.insert(std::make_pair(ConverterKey(typeName), nullptr));
     nonExistingTypeNames.insert(typeName);
 }
 
+static std::pair<SbkConverter *, bool> findConverter(const ConverterKey &key)
+{
+    std::lock_guard<Shiboken::Mutex> guard(convertersMutex);
+    auto it = converters.find(key);
+    if (it == converters.end())
+        return {nullptr, false};
+    return {it->second, true};
+}
+
 SbkConverter *getConverter(const char *typeNameC)
 {
-    std::string typeName = typeNameC;
-    auto it = converters.find(typeName);
+    const ConverterKey key{std::string(typeNameC)};
+    const std::string &typeName = key.name;
     // PYSIDE-2404: This can also contain explicit nullptr as a negative cache.
-    if (it != converters.end())
-        return it->second;
+    auto found = findConverter(key);
+    if (found.second)
+        return found.first;
     // PYSIDE-2404: Did not find the name. Load the lazy classes
     //              which have this name and try again.
     Shiboken::Module::loadLazyClassesWithName(getRealTypeName(typeName).c_str());
-    it = converters.find(typeName);
-    if (it != converters.end())
-        return it->second;
-    // Cache the negative result. Don't forget to clear the cache for new modules.
-    rememberAsNonexistent(typeName);
+    {
+        std::lock_guard<Shiboken::Mutex> guard(convertersMutex);
+        auto it = converters.find(key);
+        if (it != converters.end())
+            return it->second;
+        // Cache the negative result. Don't forget to clear the cache for new modules.
+        rememberAsNonexistent(typeName);
+    }
 
     if (Shiboken::pyVerbose() > 0) {
         const std::string message =
@@ -592,11 +683,8 @@ SbkConverter *getConverter(const char *typeNameC)
 
 void clearNegativeLazyCache()
 {
-    for (const auto &typeName : nonExistingTypeNames) {
-        auto it = converters.find(typeName);
-        converters.erase(it);
-    }
-    nonExistingTypeNames.clear();
+    std::lock_guard<Shiboken::Mutex> guard(convertersMutex);
+    clearNegativeLazyCacheHelper();
 }
 
 SbkConverter *primitiveTypeConverter(int index)
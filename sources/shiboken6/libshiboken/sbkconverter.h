@@ -10,8 +10,12 @@
 #include "sbkenum.h"
 #include "basewrapper_p.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
 #include <limits>
 #include <string>
+#include <string_view>
 
 struct SbkObject;
 
@@ -189,6 +193,18 @@ LIBSHIBOKEN_API PyObject *referenceToPython(const SbkConverter *converter, const
 LIBSHIBOKEN_API PyObject *copyToPython(PyTypeObject *type, const void *cppIn);
 LIBSHIBOKEN_API PyObject *copyToPython(const SbkConverter *converter, const void *cppIn);
 
+/// Returns a new reference to the existing Python wrapper of the C++ object
+/// \p cppIn or nullptr if there is none.
+LIBSHIBOKEN_API PyObject *existingWrapper(const void *cppIn);
+
+/**
+ *  Implementation of the C++ to Python pointer conversion of wrapped classes
+ *  without virtual destructor used by the generated converters: returns the
+ *  existing wrapper of \p cppIn or creates one using heuristics to find the
+ *  most derived type.
+ */
+LIBSHIBOKEN_API PyObject *pointerToPythonWithHeuristics(PyTypeObject *type, const void *cppIn);
+
 // Python -> C++ ---------------------------------------------------------------------------
 
 struct PythonToCppConversion
@@ -205,6 +221,25 @@ struct PythonToCppConversion
     Type type = Invalid;
 };
 
+/**
+ *  Returns the index of the type of \p pyIn in \p types (not considering
+ *  subclasses) or -1. Used by the overload decisors for argument positions
+ *  taking only wrapper types. Entries of types which have not been created
+ *  yet (lazy loading) are nullptr.
+ */
+template <std::size_t N>
+inline int exactTypeIndex(PyObject *pyIn, PyTypeObject *const (&types)[N])
+{
+    if (pyIn != nullptr) {
+        const PyTypeObject *type = Py_TYPE(pyIn);
+        for (std::size_t i = 0; i < N; ++i) {
+            if (types[i] == type)
+                return int(i);
+        }
+    }
+    return -1;
+}
+
 /**
  *  Returns a Python to C++ conversion function if the Python object is convertible to a C++ pointer.
  *  It returns NULL if the Python object is not convertible to \p type.
@@ -262,6 +297,29 @@ LIBSHIBOKEN_API void pythonToCppCopy(const SbkConverter *converter, PyObject *py
  */
 LIBSHIBOKEN_API void nonePythonToCppNullPtr(PyObject *, void *cppOut);
 
+/**
+ *  Implementation of the generated convertible checking functions for the
+ *  Python to C++ pointer conversion of wrapped classes: returns
+ *  nonePythonToCppNullPtr for None and \p toCpp if \p pyIn is an instance
+ *  of \p type. Inline since it is on the path of overload resolution.
+ */
+inline PythonToCppFunc checkPythonToCppPointer(PyTypeObject *type, PyObject *pyIn,
+                                               PythonToCppFunc toCpp)
+{
+    if (pyIn == Py_None)
+        return nonePythonToCppNullPtr;
+    return PyObject_TypeCheck(pyIn, type) ? toCpp : nullptr;
+}
+
+/// Implementation of the generated convertible checking functions for the
+/// Python to C++ copy conversion of wrapped value types: returns \p toCpp if
+/// \p pyIn is an instance of \p type.
+inline PythonToCppFunc checkPythonToCppCopy(PyTypeObject *type, PyObject *pyIn,
+                                            PythonToCppFunc toCpp)
+{
+    return PyObject_TypeCheck(pyIn, type) ? toCpp : nullptr;
+}
+
 /**
  *  Returns true if the \p toCpp function passed is an implicit conversion of Python \p type.
  *  It is used when C++ expects a reference argument, so it may be the same object received
@@ -278,6 +336,36 @@ LIBSHIBOKEN_API void registerConverterName(SbkConverter *converter, const char *
 /// unless there is already a converter for the name. Use for partially qualified names.
 LIBSHIBOKEN_API void registerConverterAlias(SbkConverter *converter, const char *typeName);
 
+/// Returns the hash of a type name in the table of converters (64bit FNV-1a),
+/// which the generator computes in advance for registerConverterNames().
+constexpr std::uint64_t converterNameHash(std::string_view typeName) noexcept
+{
+    std::uint64_t result = 14695981039346656037ULL;
+    for (const char c : typeName) {
+        result ^= static_cast<unsigned char>(c);
+        result *= 1099511628211ULL;
+    }
+    return result;
+}
+
+/// Type name passed to registerConverterNames() with its converterNameHash().
+struct ConverterName
+{
+    std::uint64_t hash;
+    const char *name;
+};
+
+/// Registers a converter with several type names and aliases at once, which
+/// is equivalent to calling registerConverterName() for \p typeNames and
+/// registerConverterAlias() for \p aliases. Use when initializing modules.
+LIBSHIBOKEN_API void registerConverterNames(SbkConverter *converter,
+                                            std::initializer_list<ConverterName> typeNames,
+                                            std::initializer_list<ConverterName> aliases = {});
+
+/// Reserves space for \p count further type names in the table of converters.
+/// Called by the module initialization with the number of names it registers.
+LIBSHIBOKEN_API void reserveConverterNames(std::size_t count);
+
 /// Returns the converter for a given type name, or NULL if it wasn't registered before.
 LIBSHIBOKEN_API SbkConverter *getConverter(const char *typeName);
 
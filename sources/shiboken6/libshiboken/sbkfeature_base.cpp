@@ -53,6 +53,11 @@ SelectableFeatureHook initSelectableFeature(SelectableFeatureHook func)
         featureCb(SelectFeatureSet != nullptr);
     return ret;
 }
+
+bool isSelectableFeatureEnabled()
+{
+    return SelectFeatureSet != nullptr;
+}
 //
 ////////////////////////////////////////////////////////////////////////////
 
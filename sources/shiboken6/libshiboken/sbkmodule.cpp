@@ -8,7 +8,9 @@
 #include "sbkstring.h"
 #include "sbkcppstring.h"
 #include "sbkconverter_p.h"
+#include "sbkmutex.h"
 
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -36,6 +38,9 @@ using ModuleToFuncsMap = std::unordered_map<PyObject *, NameToTypeFunctionMap> ;
 static ModuleTypesMap moduleTypes;
 static ModuleConvertersMap moduleConverters;
 static ModuleToFuncsMap moduleToFuncs;
+/// Protects the above tables (free-threaded build). The tables must not be
+/// iterated across calls into Python which may import further modules.
+static Shiboken::Mutex moduleTablesMutex;
 
 namespace Shiboken
 {
@@ -80,8 +85,31 @@ LIBSHIBOKEN_API PyTypeObject *get(TypeInitStruct &typeStruct)
     return typeStruct.type;
 }
 
-static void incarnateHelper(PyObject *module, const std::string_view names,
-                            const NameToTypeFunctionMap &nameToFunc)
+// Return a copy of the creation struct of a type which was not created yet.
+static bool findTypeCreationStruct(PyObject *module, const std::string &name,
+                                   TypeCreationStruct *result)
+{
+    std::lock_guard<Mutex> guard(moduleTablesMutex);
+    auto tableIter = moduleToFuncs.find(module);
+    if (tableIter == moduleToFuncs.end())
+        return false;
+    const auto &nameToFunc = tableIter->second;
+    auto funcIter = nameToFunc.find(name);
+    if (funcIter == nameToFunc.end())
+        return false;
+    *result = funcIter->second;
+    return true;
+}
+
+static void eraseTypeCreationStruct(PyObject *module, const std::string &name)
+{
+    std::lock_guard<Mutex> guard(moduleTablesMutex);
+    auto tableIter = moduleToFuncs.find(module);
+    if (tableIter != moduleToFuncs.end())
+        tableIter->second.erase(name);
+}
+
+static void incarnateHelper(PyObject *module, const std::string_view names)
 {
     auto dotPos = names.find('.');
     std::string::size_type startPos = 0;
@@ -94,9 +122,10 @@ static void incarnateHelper(PyObject *module, const std::string_view names,
         dotPos = names.find('.', startPos);
     }
     // now we have the type to create.
-    auto funcIter = nameToFunc.find(std::string(names));
+    TypeCreationStruct tcStruct;
+    if (!findTypeCreationStruct(module, std::string(names), &tcStruct))
+        return;
     // - call this function that returns a PyTypeObject
-    auto tcStruct = funcIter->second;
     auto initFunc = tcStruct.func;
     PyTypeObject *type = initFunc(modOrType);
     auto name = names.substr(startPos);
@@ -104,27 +133,24 @@ static void incarnateHelper(PyObject *module, const std::string_view names,
 }
 
 static void incarnateSubtypes(PyObject *module,
-                              const std::vector<std::string> &nameList,
-                              NameToTypeFunctionMap &nameToFunc)
+                              const std::vector<std::string> &nameList)
 {
     for (auto const & tableIter : nameList) {
         std::string_view names(tableIter);
-        incarnateHelper(module, names, nameToFunc);
+        incarnateHelper(module, names);
     }
 }
 
-static PyTypeObject *incarnateType(PyObject *module, const char *name,
-                                   NameToTypeFunctionMap &nameToFunc)
+static PyTypeObject *incarnateType(PyObject *module, const char *name)
 {
     // - locate the name and retrieve the generating function
-    auto funcIter = nameToFunc.find(name);
-    if (funcIter == nameToFunc.end()) {
+    TypeCreationStruct tcStruct;
+    if (!findTypeCreationStruct(module, name, &tcStruct)) {
         // attribute does really not exist.
         PyErr_SetNone(PyExc_AttributeError);
         return nullptr;
     }
     // - call this function that returns a PyTypeObject
-    auto tcStruct = funcIter->second;
     auto initFunc = tcStruct.func;
     auto *modOrType{module};
 
@@ -132,7 +158,7 @@ static PyTypeObject *incarnateType(PyObject *module, const char *name,
     auto saveFeature = initSelectableFeature(nullptr);
     PyTypeObject *type = initFunc(modOrType);
     if (!tcStruct.subtypeNames.empty())
-        incarnateSubtypes(module, tcStruct.subtypeNames, nameToFunc);
+        incarnateSubtypes(module, tcStruct.subtypeNames);
     initSelectableFeature(saveFeature);
 
     // - assign this object to the name in the module
@@ -140,8 +166,7 @@ static PyTypeObject *incarnateType(PyObject *module, const char *name,
     Py_INCREF(res);
     PyModule_AddObject(module, name, res);   // steals reference
     // - remove the entry, if not by something cleared.
-    if (!nameToFunc.empty())
-        nameToFunc.erase(funcIter);
+    eraseTypeCreationStruct(module, name);
     // - return the PyTypeObject.
     return type;
 }
@@ -151,34 +176,36 @@ static PyTypeObject *incarnateType(PyObject *module, const char *name,
 // the creation of the type(s), this is efficient.
 void loadLazyClassesWithName(const char *name)
 {
-    for (auto const & tableIter : moduleToFuncs) {
-        auto nameToFunc = tableIter.second;
-        auto funcIter = nameToFunc.find(name);
-        if (funcIter != nameToFunc.end()) {
+    std::vector<PyObject *> modules;
+    {
+        std::lock_guard<Mutex> guard(moduleTablesMutex);
+        for (auto const & tableIter : moduleToFuncs) {
+            const auto &nameToFunc = tableIter.second;
             // attribute exists in the lazy types.
-            auto *module = tableIter.first;
-            incarnateType(module, name, nameToFunc);
+            if (nameToFunc.find(name) != nameToFunc.end())
+                modules.push_back(tableIter.first);
         }
     }
+    for (auto *module : modules)
+        incarnateType(module, name);
 }
 
 // PYSIDE-2404: Completely load all not yet loaded classes.
 //              This is needed to resolve a star import.
 void resolveLazyClasses(PyObject *module)
 {
-    // - locate the module in the moduleTofuncs mapping
-    auto tableIter = moduleToFuncs.find(module);
-    if (tableIter == moduleToFuncs.end())
-        return;
-
-    // - see if there are still unloaded elements
-    auto &nameToFunc = tableIter->second;
-
-    // - incarnate all types.
-    while (!nameToFunc.empty()) {
-        auto it = nameToFunc.begin();
-        auto attrNameStr = it->first;
-        incarnateType(module, attrNameStr.c_str(), nameToFunc);
+    // - incarnate all types as long as there are still unloaded elements
+    while (true) {
+        std::string attrNameStr;
+        {
+            std::lock_guard<Mutex> guard(moduleTablesMutex);
+            // - locate the module in the moduleTofuncs mapping
+            auto tableIter = moduleToFuncs.find(module);
+            if (tableIter == moduleToFuncs.end() || tableIter->second.empty())
+                return;
+            attrNameStr = tableIter->second.begin()->first;
+        }
+        incarnateType(module, attrNameStr.c_str());
     }
 }
 
@@ -197,16 +224,19 @@ static PyObject *PyModule_lazyGetAttro(PyObject *module, PyObject *name)
 
     PyErr_Clear();
     // - locate the module in the moduleTofuncs mapping
-    auto tableIter = moduleToFuncs.find(module);
+    bool isOurModule{};
+    {
+        std::lock_guard<Mutex> guard(moduleTablesMutex);
+        isOurModule = moduleToFuncs.find(module) != moduleToFuncs.end();
+    }
     // - if this is not our module, use the original
-    if (tableIter == moduleToFuncs.end())
+    if (!isOurModule)
         return origModuleGetattro(module, name);
 
     // - locate the name and retrieve the generating function
     const char *attrNameStr = Shiboken::String::toCString(name);
-    auto &nameToFunc = tableIter->second;
     // - create the real type and handle subtypes
-    auto *type = incarnateType(module, attrNameStr, nameToFunc);
+    auto *type = incarnateType(module, attrNameStr);
     auto *ret = reinterpret_cast<PyObject *>(type);
     // - if attribute does really not exist use the original
     if (ret == nullptr && PyErr_ExceptionMatches(PyExc_AttributeError)) {
@@ -226,15 +256,19 @@ static PyObject *_module_dir_template(PyObject * /* self */, PyObject *args)
     if (!PyArg_ParseTuple(args, "O", &module))
         return nullptr;
 
-    auto tableIter = moduleToFuncs.find(module);
-    assert(tableIter != moduleToFuncs.end());
+    std::vector<std::string> names;
+    {
+        std::lock_guard<Shiboken::Mutex> guard(moduleTablesMutex);
+        auto tableIter = moduleToFuncs.find(module);
+        assert(tableIter != moduleToFuncs.end());
+        for (const auto &funcIter : tableIter->second)
+            names.push_back(funcIter.first);
+    }
     Shiboken::AutoDecRef dict(PyObject_GetAttr(module, _dict));
     auto *ret = PyDict_Keys(dict);
     // Now add all elements that were not yet in the dict.
-    auto &nameToFunc = tableIter->second;
-    for (const auto &funcIter : nameToFunc) {
-        const char *name = funcIter.first.c_str();
-        Shiboken::AutoDecRef pyName(PyUnicode_FromString(name));
+    for (const auto &name : names) {
+        Shiboken::AutoDecRef pyName(PyUnicode_FromString(name.c_str()));
         PyList_Append(ret, pyName);
     }
     return ret;
@@ -324,6 +358,7 @@ static bool canNotLazyLoad(PyObject *module)
     const char *modName = PyModule_GetName(module);
 
     // There are no more things that must be disabled :-D
+    std::lock_guard<Mutex> guard(moduleTablesMutex);
     return dontLazyLoad.find(modName) != dontLazyLoad.end();
 }
 
@@ -338,9 +373,11 @@ static bool shouldLazyLoad(PyObject *module)
 
 static int lazyLoadDefault()
 {
-#ifndef PYPY_VERSION
+#if !defined(PYPY_VERSION) && !defined(Py_GIL_DISABLED)
     int result = 1;
 #else
+    // PyPy and the free-threaded build. The latter creates the types while
+    // importing the module instead of in the first thread accessing them.
     int result = 0;
 #endif
     if (auto *flag = getenv("PYSIDE6_OPTION_LAZY"))
@@ -348,8 +385,7 @@ static int lazyLoadDefault()
     return result;
 }
 
-void checkIfShouldLoadImmediately(PyObject *module, const std::string &name,
-                                  const NameToTypeFunctionMap &nameToFunc)
+void checkIfShouldLoadImmediately(PyObject *module, const std::string &name)
 {
     static const int value = lazyLoadDefault();
 
@@ -365,7 +401,7 @@ void checkIfShouldLoadImmediately(PyObject *module, const std::string &name,
         || canNotLazyLoad(module)                   // for some reason we cannot lazy load
         || (value == 1 && !shouldLazyLoad(module))  // not a known module
         ) {
-        incarnateHelper(module, name, nameToFunc);
+        incarnateHelper(module, name);
     }
 }
 
@@ -373,19 +409,22 @@ void AddTypeCreationFunction(PyObject *module,
                              const char *name,
                              TypeCreationFunction func)
 {
-    // - locate the module in the moduleTofuncs mapping
-    auto tableIter = moduleToFuncs.find(module);
-    assert(tableIter != moduleToFuncs.end());
-    // - Assign the name/generating function tcStruct.
-    auto &nameToFunc = tableIter->second;
-    TypeCreationStruct tcStruct{func, {}};
-    auto nit = nameToFunc.find(name);
-    if (nit == nameToFunc.end())
-        nameToFunc.insert(std::make_pair(name, tcStruct));
-    else
-        nit->second = tcStruct;
+    {
+        std::lock_guard<Mutex> guard(moduleTablesMutex);
+        // - locate the module in the moduleTofuncs mapping
+        auto tableIter = moduleToFuncs.find(module);
+        assert(tableIter != moduleToFuncs.end());
+        // - Assign the name/generating function tcStruct.
+        auto &nameToFunc = tableIter->second;
+        TypeCreationStruct tcStruct{func, {}};
+        auto nit = nameToFunc.find(name);
+        if (nit == nameToFunc.end())
+            nameToFunc.insert(std::make_pair(name, tcStruct));
+        else
+            nit->second = tcStruct;
+    }
 
-    checkIfShouldLoadImmediately(module, name, nameToFunc);
+    checkIfShouldLoadImmediately(module, name);
 }
 
 void AddTypeCreationFunction(PyObject *module,
@@ -393,24 +432,27 @@ void AddTypeCreationFunction(PyObject *module,
                              TypeCreationFunction func,
                              const char *namePath)
 {
-    // - locate the module in the moduleTofuncs mapping
-    auto tableIter = moduleToFuncs.find(module);
-    assert(tableIter != moduleToFuncs.end());
-    // - Assign the name/generating function tcStruct.
-    auto &nameToFunc = tableIter->second;
-    auto nit = nameToFunc.find(containerName);
-
-    // - insert namePath into the subtype vector of the main type.
-    nit->second.subtypeNames.emplace_back(namePath);
-    // - insert it also as its own entry.
-    nit = nameToFunc.find(namePath);
-    TypeCreationStruct tcStruct{func, {}};
-    if (nit == nameToFunc.end())
-        nameToFunc.insert(std::make_pair(namePath, tcStruct));
-    else
-        nit->second = tcStruct;
+    {
+        std::lock_guard<Mutex> guard(moduleTablesMutex);
+        // - locate the module in the moduleTofuncs mapping
+        auto tableIter = moduleToFuncs.find(module);
+        assert(tableIter != moduleToFuncs.end());
+        // - Assign the name/generating function tcStruct.
+        auto &nameToFunc = tableIter->second;
+        auto nit = nameToFunc.find(containerName);
+
+        // - insert namePath into the subtype vector of the main type.
+        nit->second.subtypeNames.emplace_back(namePath);
+        // - insert it also as its own entry.
+        nit = nameToFunc.find(namePath);
+        TypeCreationStruct tcStruct{func, {}};
+        if (nit == nameToFunc.end())
+            nameToFunc.insert(std::make_pair(namePath, tcStruct));
+        else
+            nit->second = tcStruct;
+    }
 
-    checkIfShouldLoadImmediately(module, namePath, nameToFunc);
+    checkIfShouldLoadImmediately(module, namePath);
 }
 
 PyObject *import(const char *moduleName)
@@ -472,12 +514,16 @@ PyObject *create(const char * /* modName */, void *moduleData)
     auto *moduleDir = PyObject_CallFunctionObjArgs(partial, moduleDirTemplate, module, nullptr);
     PyModule_AddObject(module, module_methods->ml_name, moduleDir);  // steals reference
     // Insert an initial empty table for the module.
-    NameToTypeFunctionMap empty;
-    moduleToFuncs.insert(std::make_pair(module, empty));
-
-    // A star import must be done unconditionally. Use the complete name.
-    if (isImportStar(module))
-        dontLazyLoad.insert(PyModule_GetName(module));
+    const bool importStar = isImportStar(module);
+    {
+        std::lock_guard<Mutex> guard(moduleTablesMutex);
+        NameToTypeFunctionMap empty;
+        moduleToFuncs.insert(std::make_pair(module, empty));
+
+        // A star import must be done unconditionally. Use the complete name.
+        if (importStar)
+            dontLazyLoad.insert(PyModule_GetName(module));
+    }
 
     if (!lazy_init) {
         // Install the getattr patch.
@@ -502,8 +548,16 @@ PyObject *create(const char * /* modName */, void *moduleData)
     return module;
 }
 
+void setGilNotUsed([[maybe_unused]] PyObject *module)
+{
+#ifdef Py_GIL_DISABLED
+    PyUnstable_Module_SetGIL(module, Py_MOD_GIL_NOT_USED);
+#endif
+}
+
 void registerTypes(PyObject *module, TypeInitStruct *types)
 {
+    std::lock_guard<Mutex> guard(moduleTablesMutex);
     auto iter = moduleTypes.find(module);
     if (iter == moduleTypes.end())
         moduleTypes.insert(std::make_pair(module, types));
@@ -511,12 +565,14 @@ void registerTypes(PyObject *module, TypeInitStruct *types)
 
 TypeInitStruct *getTypes(PyObject *module)
 {
+    std::lock_guard<Mutex> guard(moduleTablesMutex);
     auto iter = moduleTypes.find(module);
     return (iter == moduleTypes.end()) ? 0 : iter->second;
 }
 
 void registerTypeConverters(PyObject *module, SbkConverter **converters)
 {
+    std::lock_guard<Mutex> guard(moduleTablesMutex);
     auto iter = moduleConverters.find(module);
     if (iter == moduleConverters.end())
         moduleConverters.insert(std::make_pair(module, converters));
@@ -524,6 +580,7 @@ void registerTypeConverters(PyObject *module, SbkConverter **converters)
 
 SbkConverter **getTypeConverters(PyObject *module)
 {
+    std::lock_guard<Mutex> guard(moduleTablesMutex);
     auto iter = moduleConverters.find(module);
     return (iter == moduleConverters.end()) ? 0 : iter->second;
 }
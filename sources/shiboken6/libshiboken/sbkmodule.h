@@ -44,6 +44,14 @@ LIBSHIBOKEN_API PyObject *import(const char *moduleName);
  */
 LIBSHIBOKEN_API PyObject *create(const char *moduleName, void *moduleData);
 
+/**
+ *  Declares that \p module does not need the GIL in free-threaded builds of
+ *  Python (generator option --gil-not-used). The global state of libshiboken
+ *  is synchronized (see sbkmutex.h); the bindings must be thread-safe as well.
+ *  Does nothing with the GIL.
+ */
+LIBSHIBOKEN_API void setGilNotUsed(PyObject *module);
+
 using TypeCreationFunction = PyTypeObject *(*)(PyObject *module);
 
 /// Adds a type creation function to the module.
@@ -0,0 +1,56 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef SBKMUTEX_H
+#define SBKMUTEX_H
+
+#include "sbkpython.h"
+
+// Synchronization of global tables for free-threaded builds of Python
+// (3.13t, Py_GIL_DISABLED). In the default build, the tables are protected
+// by the GIL and the primitives below compile to nothing.
+
+namespace Shiboken
+{
+
+/// Mutex for tables of plain C++ data (hashes of names, converters).
+/// In free-threaded builds, it is a PyMutex, which detaches the thread state
+/// while waiting so that it does not block the garbage collector. Python code
+/// must not be called while it is locked; use SBK_BEGIN_CRITICAL_SECTION()
+/// for data that is modified along with Python objects.
+class Mutex
+{
+public:
+    Mutex(const Mutex &) = delete;
+    Mutex(Mutex &&) = delete;
+    Mutex &operator=(const Mutex &) = delete;
+    Mutex &operator=(Mutex &&) = delete;
+
+    Mutex() noexcept = default;
+    ~Mutex() = default;
+
+#ifdef Py_GIL_DISABLED
+    void lock() { PyMutex_Lock(&m_mutex); }
+    void unlock() { PyMutex_Unlock(&m_mutex); }
+
+private:
+    PyMutex m_mutex{};
+#else
+    void lock() {}
+    void unlock() {}
+#endif
+};
+
+} // namespace Shiboken
+
+// Per-object critical section (PEP 703). The macros of Python are only
+// available as of 3.13 and not in the limited API.
+#ifdef Py_GIL_DISABLED
+#  define SBK_BEGIN_CRITICAL_SECTION(op) Py_BEGIN_CRITICAL_SECTION(op)
+#  define SBK_END_CRITICAL_SECTION() Py_END_CRITICAL_SECTION()
+#else
+#  define SBK_BEGIN_CRITICAL_SECTION(op) {
+#  define SBK_END_CRITICAL_SECTION() }
+#endif
+
+#endif // SBKMUTEX_H
@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "shibokenbuffer.h"
+#include "autodecref.h"
+#include "voidptr.h"
+
 #include <cstdlib>
 #include <cstring>
 
@@ -68,3 +71,42 @@ PyObject *Shiboken::Buffer::newObject(const void *memory, Py_ssize_t size)
 {
     return newObject(const_cast<void *>(memory), size, ReadOnly);
 }
+
+PyObject *Shiboken::Buffer::newObject(const void *memory, Py_ssize_t size, PyObject *owner)
+{
+    Shiboken::AutoDecRef voidPtr(VoidPtr::createWithOwner(const_cast<void *>(memory),
+                                                          size, false, owner));
+    if (voidPtr.isNull())
+        return nullptr;
+    return PyMemoryView_FromObject(voidPtr);
+}
+
+PyObject *Shiboken::Buffer::newTemporaryObject(void *memory, Py_ssize_t size)
+{
+    static char emptyMemory = 0;
+    // Export through a VoidPtr, which is referenced by every memoryview
+    // sharing the memory, so that releaseTemporaryObject() can detect them.
+    Shiboken::AutoDecRef voidPtr(VoidPtr::createWithOwner(size > 0 ? memory : &emptyMemory,
+                                                          size, true, nullptr));
+    if (voidPtr.isNull())
+        return nullptr;
+    return PyMemoryView_FromObject(voidPtr);
+}
+
+bool Shiboken::Buffer::releaseTemporaryObject(PyObject *buffer)
+{
+    Shiboken::AutoDecRef voidPtr(PyObject_GetAttrString(buffer, "obj"));
+    if (voidPtr.isNull())
+        return false;
+    // Fails when a buffer was exported from the memoryview
+    Shiboken::AutoDecRef released(PyObject_CallMethod(buffer, "release", nullptr));
+    if (released.isNull())
+        return false;
+    // Slices and casts of the memoryview still reference the VoidPtr
+    if (Py_REFCNT(voidPtr.object()) > 1) {
+        PyErr_SetString(PyExc_BufferError,
+                        "A view on a temporary buffer was kept beyond the call.");
+        return false;
+    }
+    return true;
+}
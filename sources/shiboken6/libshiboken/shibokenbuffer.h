@@ -27,6 +27,28 @@ namespace Shiboken::Buffer
      */
     LIBSHIBOKEN_API PyObject *newObject(const void *memory, Py_ssize_t size);
 
+    /**
+     * Creates a new <b>read only</b> Python buffer pointing to a contiguous memory block at
+     * \p memory of size \p size, which is owned by \p owner. A reference to \p owner
+     * is held until the buffer is released, so that no copy of the memory is needed.
+     */
+    LIBSHIBOKEN_API PyObject *newObject(const void *memory, Py_ssize_t size, PyObject *owner);
+
+    /**
+     * Creates a new <b>writable</b> Python buffer pointing to a contiguous memory block at
+     * \p memory of size \p size, which is only valid for the duration of a call into
+     * Python (for example, a destination buffer passed to an override). Unlike
+     * newObject(), an empty buffer is returned for a size of 0. The buffer must be
+     * released by releaseTemporaryObject() before the memory goes away.
+     */
+    LIBSHIBOKEN_API PyObject *newTemporaryObject(void *memory, Py_ssize_t size);
+
+    /**
+     * Releases a buffer created by newTemporaryObject(). Returns false and sets a
+     * BufferError if Python code still holds a view on the memory.
+     */
+    LIBSHIBOKEN_API bool releaseTemporaryObject(PyObject *buffer);
+
     /**
      * Check if is ok to use \p pyObj as argument in all function under Shiboken::Buffer namespace.
      */
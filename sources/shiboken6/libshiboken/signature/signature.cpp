@@ -22,6 +22,7 @@
 #include "sbkstaticstrings.h"
 #include "sbkstaticstrings_p.h"
 #include "sbkfeature_base.h"
+#include "sbktypefactory.h"
 
 #include <structmember.h>
 
@@ -364,44 +365,23 @@ static int PySide_BuildSignatureArgsByte(PyObject *obtype_mod, const uint8_t sig
     return PyDict_SetItem(pyside_globals->map_dict, type_key, obtype_mod) == 0 ? 0 : -1;
 }
 
-// PYSIDE-2701: MS cannot use the name "_expand".
-static PyObject *byteExpand(PyObject *packed)
-{
-    const char commonMsg[] = "Please disable compression by passing  --unoptimize=compression";
-
-    static PyObject *compressModule = PyImport_ImportModule("zlib");
-    if (compressModule == nullptr)
-        return PyErr_Format(PyExc_ImportError,
-                            "The zlib module cannot be imported. %s", commonMsg);
-
-    static PyObject *expandFunc = PyObject_GetAttrString(compressModule, "decompress");
-    if (expandFunc == nullptr)
-        return PyErr_Format(PyExc_NameError,
-                            "The expand function of zlib was not fount. %s", commonMsg);
-    PyObject *unpacked = PyObject_CallFunctionObjArgs(expandFunc, packed, nullptr);
-    if (unpacked == nullptr)
-        return PyErr_Format(PyExc_ValueError,
-                            "Some packed strings could not be unpacked. %s", commonMsg);
-    return unpacked;
-}
-
 const char **bytesToStrings(const uint8_t signatures[], Py_ssize_t size)
 {
     // PYSIDE-2701: Unpack a ZLIB compressed string.
     // The result is a single char* with newlines after each string. Convert
     // this into single char* objects that InitSignatureStrings expects.
+    // The expanded data is kept since the strings point into it.
 
-    const auto *chars = reinterpret_cast<const char *>(signatures);
-    PyObject *packed = PyBytes_FromStringAndSize(chars, size);
-
+    size_t len = 0;
     // The Qt compressor treats empty arrays specially.
-    PyObject *data = size > 0 ? byteExpand(packed) : PyBytes_FromStringAndSize(chars, 0);
-    if (data == nullptr)
+    char *cdata = size > 0
+        ? inflate_signature_bytes(signatures, size_t(size), &len) : new char[1]{};
+    if (cdata == nullptr) {
+        PyErr_SetString(PyExc_ValueError, "Some packed strings could not be unpacked. "
+                        "Please disable compression by passing --unoptimize=compression");
         return nullptr;
+    }
 
-    char *cdata{};
-    Py_ssize_t len{};
-    PyBytes_AsStringAndSize(data, &cdata, &len);
     char *cdataEnd = cdata + len;
     size_t nlines = std::count(cdata, cdataEnd, '\n');
 
@@ -716,15 +696,277 @@ static PyObject *adjustFuncName(const char *func_name)
     return String::fromCString(_buf);
 }
 
-void SetError_Argument(PyObject *args, const char *func_name, PyObject *info)
+static PyObject *argumentErrorType(PyObject *args, const char *func_name)
 {
+    // Returns the exception type formatArgumentError() would return, or None.
     init_shibokensupport_module();
+    AutoDecRef new_func_name(adjustFuncName(func_name));
+    if (new_func_name.isNull())
+        return nullptr;
+    return PyObject_CallFunctionObjArgs(pyside_globals->argument_error_type_func,
+                                        args, new_func_name.object(), nullptr);
+}
+
+// The exception type only depends on the function and the types of the
+// arguments, unless an argument is a container whose elements are matched
+// against a Sequence/Iterable annotation. Returns a key for caching it or
+// nullptr when the arguments cannot be cached.
+static PyObject *argumentErrorTypeKey(PyObject *args, const char *func_name)
+{
+    const bool isTuple = PyTuple_Check(args) != 0;
+    const Py_ssize_t argCount = isTuple ? PyTuple_Size(args) : 1;
+    PyObject *key = PyTuple_New(argCount + 1);
+    if (key == nullptr)
+        return nullptr;
+    PyTuple_SetItem(key, 0, PyUnicode_FromString(func_name));
+    for (Py_ssize_t i = 0; i < argCount; ++i) {
+        PyObject *arg = isTuple ? PyTuple_GetItem(args, i) : args;
+        PyTypeObject *argType = Py_TYPE(arg);
+        if (argType != &PyUnicode_Type
+            && (argType->tp_iter != nullptr || PySequence_Check(arg) != 0)) {
+            Py_DECREF(key);
+            return nullptr;
+        }
+        Py_INCREF(argType);
+        PyTuple_SetItem(key, i + 1, reinterpret_cast<PyObject *>(argType));
+    }
+    return key;
+}
+
+static PyObject *cachedArgumentErrorType(PyObject *args, const char *func_name)
+{
+    static constexpr Py_ssize_t maxCacheSize = 512;
+    static PyObject *const cache = PyDict_New();
+
+    AutoDecRef key(argumentErrorTypeKey(args, func_name));
+    if (key.isNull()) {
+        PyErr_Clear();
+        return argumentErrorType(args, func_name);
+    }
+    if (PyObject *type = PyDict_GetItem(cache, key.object())) {
+        Py_INCREF(type);
+        return type;
+    }
+    PyObject *type = argumentErrorType(args, func_name);
+    if (type != nullptr && type != Py_None) {
+        if (PyDict_Size(cache) >= maxCacheSize)
+            PyDict_Clear(cache);
+        PyDict_SetItem(cache, key.object(), type);
+    }
+    return type;
+}
+
+static PyObject *formatArgumentError(PyObject *args, const char *func_name, PyObject *info)
+{
+    // Returns a tuple (exception type, message).
+    init_shibokensupport_module();
+    // PYSIDE-1019: Modify the function name expression according to feature.
+    AutoDecRef new_func_name(adjustFuncName(func_name));
+    if (new_func_name.isNull())
+        return nullptr;
+    if (info == nullptr)
+        info = Py_None;
+    return PyObject_CallFunctionObjArgs(pyside_globals->seterror_argument_func,
+                                        args, new_func_name.object(), info, nullptr);
+}
+
+/*
+ * Lazily formatted argument errors.
+ *
+ * Failed overload resolution is used for duck-typing by some code
+ * (`try: obj.func(x) except TypeError:`). Formatting the message in Python
+ * is expensive, so in the plain case of wrong arguments, a subclass of the
+ * TypeError or ValueError determined by the signature module is raised which
+ * keeps the arguments and the function name. The message is formatted when
+ * `args`, `str()` or `repr()` is requested.
+ */
+static PyObject *argumentErrorKey()
+{
+    static PyObject *const key = String::createStaticString("_sbk_argument_error");
+    return key;
+}
+
+static PyObject *baseExceptionAttribute(const char *name)
+{
+    return PyObject_GetAttrString(PyExc_BaseException, name);
+}
+
+static void ArgumentError_format(PyObject *self)
+{
+    // Formatting may happen while an exception is pending (traceback printing).
+    PyObject *errType{};
+    PyObject *errValue{};
+    PyObject *errTraceback{};
+    PyErr_Fetch(&errType, &errValue, &errTraceback);
+    PyObject *lazy = PyObject_GetAttr(self, argumentErrorKey());
+    if (lazy == nullptr) {
+        PyErr_Restore(errType, errValue, errTraceback);
+        return;
+    }
+    AutoDecRef lazyInfo(lazy);
+    PyObject_DelAttr(self, argumentErrorKey());
+
+    PyObject *args = PyTuple_GetItem(lazy, 0);
+    const char *funcName = String::toCString(PyTuple_GetItem(lazy, 1));
+    AutoDecRef res(formatArgumentError(args, funcName, nullptr));
+    PyObject *msg{};
+    if (res.isNull() || !PyTuple_Check(res.object()) || PyTuple_Size(res.object()) != 2) {
+        PyErr_Clear();
+        msg = PyUnicode_FromFormat("'%s' called with wrong argument types", funcName);
+    } else {
+        msg = PyTuple_GetItem(res.object(), 1);
+        Py_INCREF(msg);
+    }
+    AutoDecRef excArgs(PyTuple_Pack(1, msg));
+    Py_DECREF(msg);
+    static PyObject *const argsDescr = baseExceptionAttribute("args");
+    AutoDecRef setRes(PyObject_CallMethod(argsDescr, "__set__", "OO", self, excArgs.object()));
+    if (setRes.isNull())
+        PyErr_Clear();
+    PyErr_Restore(errType, errValue, errTraceback);
+}
+
+static PyObject *ArgumentError_getArgs(PyObject *self, void * /* unused */)
+{
+    ArgumentError_format(self);
+    static PyObject *const argsDescr = baseExceptionAttribute("args");
+    return PyObject_CallMethod(argsDescr, "__get__", "O", self);
+}
+
+static int ArgumentError_setArgs(PyObject *self, PyObject *value, void * /* unused */)
+{
+    ArgumentError_format(self);
+    static PyObject *const argsDescr = baseExceptionAttribute("args");
+    AutoDecRef res(value != nullptr
+                   ? PyObject_CallMethod(argsDescr, "__set__", "OO", self, value)
+                   : PyObject_CallMethod(argsDescr, "__delete__", "O", self));
+    return res.isNull() ? -1 : 0;
+}
+
+static PyObject *ArgumentError_callBase(PyObject *self, PyObject *baseFunc)
+{
+    ArgumentError_format(self);
+    return PyObject_CallFunctionObjArgs(baseFunc, self, nullptr);
+}
+
+static PyObject *ArgumentError_str(PyObject *self)
+{
+    static PyObject *const func = baseExceptionAttribute("__str__");
+    return ArgumentError_callBase(self, func);
+}
+
+static PyObject *ArgumentError_repr(PyObject *self)
+{
+    static PyObject *const func = baseExceptionAttribute("__repr__");
+    return ArgumentError_callBase(self, func);
+}
+
+// Pickle as plain TypeError or ValueError, the types are not importable.
+static PyObject *ArgumentError_reduce(PyObject *self, PyObject * /* unused */)
+{
+    AutoDecRef args(ArgumentError_getArgs(self, nullptr));
+    if (args.isNull())
+        return nullptr;
+    PyObject *base = PyObject_IsInstance(self, PyExc_ValueError) == 1
+                     ? PyExc_ValueError : PyExc_TypeError;
+    return Py_BuildValue("(OO)", base, args.object());
+}
+
+static PyGetSetDef ArgumentError_getset[] = {
+    {const_cast<char *>("args"), ArgumentError_getArgs, ArgumentError_setArgs, nullptr, nullptr},
+    {nullptr, nullptr, nullptr, nullptr, nullptr}
+};
+
+static PyMethodDef ArgumentError_methods[] = {
+    {"__reduce__", ArgumentError_reduce, METH_NOARGS, nullptr},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+static PyType_Slot ArgumentError_slots[] = {
+    {Py_tp_str, reinterpret_cast<void *>(ArgumentError_str)},
+    {Py_tp_repr, reinterpret_cast<void *>(ArgumentError_repr)},
+    {Py_tp_getset, reinterpret_cast<void *>(ArgumentError_getset)},
+    {Py_tp_methods, reinterpret_cast<void *>(ArgumentError_methods)},
+    {0, nullptr}
+};
+
+static PyType_Spec ArgumentError_spec = {
+    "Shiboken.ArgumentError",
+    0,
+    0,
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    ArgumentError_slots,
+};
+
+static PyType_Spec ArgumentValueError_spec = {
+    "Shiboken.ArgumentValueError",
+    0,
+    0,
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    ArgumentError_slots,
+};
+
+static PyTypeObject *ArgumentError_TypeF()
+{
+    static PyTypeObject *type = [] {
+        AutoDecRef bases(PyTuple_Pack(1, PyExc_TypeError));
+        return SbkType_FromSpecWithBases(&ArgumentError_spec, bases.object());
+    }();
+    return type;
+}
+
+static PyTypeObject *ArgumentValueError_TypeF()
+{
+    static PyTypeObject *type = [] {
+        AutoDecRef bases(PyTuple_Pack(1, PyExc_ValueError));
+        return SbkType_FromSpecWithBases(&ArgumentValueError_spec, bases.object());
+    }();
+    return type;
+}
+
+static bool setLazyArgumentError(PyObject *args, const char *func_name)
+{
+    if (args == nullptr)
+        args = Py_None;
+    // Keep the exception type of the formatted error (ValueError when the
+    // argument types match a signature), only the message is deferred.
+    // Determining it requires the signatures, so it is cached.
+    AutoDecRef errType(cachedArgumentErrorType(args, func_name));
+    if (errType.isNull())
+        return false;
+    PyObject *type{};
+    if (errType.object() == PyExc_TypeError)
+        type = reinterpret_cast<PyObject *>(ArgumentError_TypeF());
+    else if (errType.object() == PyExc_ValueError)
+        type = reinterpret_cast<PyObject *>(ArgumentValueError_TypeF());
+    if (type == nullptr)
+        return false;
+    AutoDecRef exc(PyObject_CallFunctionObjArgs(type, nullptr));
+    if (exc.isNull())
+        return false;
+    AutoDecRef lazy(Py_BuildValue("(Os)", args, func_name));
+    if (lazy.isNull() || PyObject_SetAttr(exc.object(), argumentErrorKey(), lazy.object()) < 0)
+        return false;
+    PyErr_SetObject(type, exc.object());
+    return true;
+}
+
+void SetError_Argument(PyObject *args, const char *func_name, PyObject *info)
+{
     /*
      * This function replaces the type error construction with extra
      * overloads parameter in favor of using the signature module.
-     * Error messages are rare, so we do it completely in Python.
+     * Wrong argument types are the common case; the message is then only
+     * formatted on demand. Everything else is done completely in Python.
+     * Features change the function name, so they are resolved immediately.
      */
+    if (info == nullptr && !PyErr_Occurred() && !isSelectableFeatureEnabled()) {
+        if (setLazyArgumentError(args, func_name))
+            return;
+        PyErr_Clear();
+    }
 
+    init_shibokensupport_module();
     // PYSIDE-1305: Handle errors set by fillQtProperties.
     if (PyErr_Occurred()) {
         PyObject *e{};
@@ -736,16 +978,7 @@ void SetError_Argument(PyObject *args, const char *func_name, PyObject *info)
         info = v;
         Py_XDECREF(t);
     }
-    // PYSIDE-1019: Modify the function name expression according to feature.
-    AutoDecRef new_func_name(adjustFuncName(func_name));
-    if (new_func_name.isNull()) {
-        PyErr_Print();
-        Py_FatalError("seterror_argument failed to call update_mapping");
-    }
-    if (info == nullptr)
-        info = Py_None;
-    AutoDecRef res(PyObject_CallFunctionObjArgs(pyside_globals->seterror_argument_func,
-                                                args, new_func_name.object(), info, nullptr));
+    AutoDecRef res(formatArgumentError(args, func_name, info));
     if (res.isNull()) {
         PyErr_Print();
         Py_FatalError("seterror_argument did not receive a result");
@@ -173,6 +173,9 @@ static int init_phase_2(safe_globals_struc *p, PyMethodDef *methods)
         p->seterror_argument_func = PyObject_GetAttrString(loader, "seterror_argument");
         if (p->seterror_argument_func == nullptr)
             break;
+        p->argument_error_type_func = PyObject_GetAttrString(loader, "argument_error_type");
+        if (p->argument_error_type_func == nullptr)
+            break;
         p->make_helptext_func = PyObject_GetAttrString(loader, "make_helptext");
         if (p->make_helptext_func == nullptr)
             break;
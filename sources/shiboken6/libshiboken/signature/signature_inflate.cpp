@@ -0,0 +1,325 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+////////////////////////////////////////////////////////////////////////////
+//
+// signature_inflate.cpp
+// ---------------------
+//
+// A minimal decoder for the zlib streams (RFC 1950/1951) produced by
+// qCompress() in the generator for the signature strings (PYSIDE-2701).
+// It replaces importing the Python zlib module at startup. Speed is
+// secondary since the blocks are small and expanded lazily per type.
+//
+
+#include "signature_p.h"
+
+#include <cstring>
+#include <vector>
+
+namespace {
+
+constexpr int maxBits = 15;             // Maximum bits in a code
+constexpr int maxLiteralCodes = 288;    // Literal/length codes (286 used)
+constexpr int maxDistanceCodes = 30;
+
+struct Huffman
+{
+    short count[maxBits + 1];           // Number of symbols of each length
+    short symbol[maxLiteralCodes];      // Symbols ordered by code
+};
+
+class Inflater
+{
+public:
+    explicit Inflater(const uint8_t *data, size_t size) : m_data(data), m_size(size) {}
+
+    bool run();
+
+    std::vector<char> &result() { return m_result; }
+
+private:
+    int bits(int need);
+    int decode(const Huffman &h);
+    bool stored();
+    bool codes(const Huffman &literals, const Huffman &distances);
+    bool fixed();
+    bool dynamic();
+
+    static bool construct(Huffman *h, const short *lengths, int n);
+
+    const uint8_t *m_data;
+    size_t m_size;
+    size_t m_pos = 0;
+    unsigned m_bitBuffer = 0;
+    int m_bitCount = 0;
+    bool m_error = false;
+    std::vector<char> m_result;
+};
+
+int Inflater::bits(int need)
+{
+    unsigned value = m_bitBuffer;
+    while (m_bitCount < need) {
+        if (m_pos == m_size) {
+            m_error = true;
+            return 0;
+        }
+        value |= unsigned(m_data[m_pos++]) << m_bitCount;
+        m_bitCount += 8;
+    }
+    m_bitBuffer = value >> need;
+    m_bitCount -= need;
+    return int(value & ((1u << need) - 1u));
+}
+
+// Build a canonical Huffman decoding table from the code lengths.
+bool Inflater::construct(Huffman *h, const short *lengths, int n)
+{
+    std::memset(h->count, 0, sizeof(h->count));
+    for (int s = 0; s < n; ++s)
+        ++h->count[lengths[s]];
+    if (h->count[0] == n)   // No codes: complete, but decoding will fail
+        return true;
+
+    int left = 1;           // Check for an over-subscribed set of lengths
+    for (int len = 1; len <= maxBits; ++len) {
+        left <<= 1;
+        left -= h->count[len];
+        if (left < 0)
+            return false;
+    }
+
+    short offsets[maxBits + 1];
+    offsets[1] = 0;
+    for (int len = 1; len < maxBits; ++len)
+        offsets[len + 1] = offsets[len] + h->count[len];
+    for (int s = 0; s < n; ++s) {
+        if (lengths[s] != 0)
+            h->symbol[offsets[lengths[s]]++] = short(s);
+    }
+    return true;
+}
+
+int Inflater::decode(const Huffman &h)
+{
+    int code = 0;   // Bits read so far
+    int first = 0;  // First code of the current length
+    int index = 0;  // Index of the first code of the current length in symbol[]
+    for (int len = 1; len <= maxBits; ++len) {
+        code |= bits(1);
+        if (m_error)
+            return -1;
+        const int count = h.count[len];
+        if (code - count < first)
+            return h.symbol[index + (code - first)];
+        index += count;
+        first += count;
+        first <<= 1;
+        code <<= 1;
+    }
+    return -1;
+}
+
+bool Inflater::stored()
+{
+    m_bitBuffer = 0;    // Discard the remaining bits of the current byte
+    m_bitCount = 0;
+    if (m_pos + 4 > m_size)
+        return false;
+    const unsigned len = m_data[m_pos] | (unsigned(m_data[m_pos + 1]) << 8);
+    const unsigned nlen = m_data[m_pos + 2] | (unsigned(m_data[m_pos + 3]) << 8);
+    m_pos += 4;
+    if (len != (~nlen & 0xffffu) || m_pos + len > m_size)
+        return false;
+    m_result.insert(m_result.end(), m_data + m_pos, m_data + m_pos + len);
+    m_pos += len;
+    return true;
+}
+
+bool Inflater::codes(const Huffman &literals, const Huffman &distances)
+{
+    static const short lengthBase[29] = {
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+        35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    static const short lengthExtra[29] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+        3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+    static const short distanceBase[30] = {
+        1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+        257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+        8193, 12289, 16385, 24577};
+    static const short distanceExtra[30] = {
+        0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+    while (true) {
+        int symbol = decode(literals);
+        if (symbol < 0)
+            return false;
+        if (symbol < 256) {
+            m_result.push_back(char(symbol));
+            continue;
+        }
+        if (symbol == 256)  // End of block
+            return true;
+        symbol -= 257;
+        if (symbol >= 29)
+            return false;
+        const size_t length = size_t(lengthBase[symbol] + bits(lengthExtra[symbol]));
+        symbol = decode(distances);
+        if (symbol < 0 || symbol >= maxDistanceCodes)
+            return false;
+        const size_t distance = size_t(distanceBase[symbol] + bits(distanceExtra[symbol]));
+        if (m_error || distance > m_result.size())
+            return false;
+        // The source may overlap the destination, copy byte-wise.
+        for (size_t i = 0; i < length; ++i)
+            m_result.push_back(m_result[m_result.size() - distance]);
+    }
+}
+
+bool Inflater::fixed()
+{
+    static Huffman literals;
+    static Huffman distances;
+    static const bool initialized = [] {
+        short lengths[maxLiteralCodes];
+        int symbol = 0;
+        for (; symbol < 144; ++symbol)
+            lengths[symbol] = 8;
+        for (; symbol < 256; ++symbol)
+            lengths[symbol] = 9;
+        for (; symbol < 280; ++symbol)
+            lengths[symbol] = 7;
+        for (; symbol < maxLiteralCodes; ++symbol)
+            lengths[symbol] = 8;
+        construct(&literals, lengths, maxLiteralCodes);
+        for (symbol = 0; symbol < maxDistanceCodes; ++symbol)
+            lengths[symbol] = 5;
+        construct(&distances, lengths, maxDistanceCodes);
+        return true;
+    }();
+    return initialized && codes(literals, distances);
+}
+
+bool Inflater::dynamic()
+{
+    static const short order[19] = {
+        16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+    const int nlen = bits(5) + 257;
+    const int ndist = bits(5) + 1;
+    const int ncode = bits(4) + 4;
+    if (m_error || nlen > 286 || ndist > maxDistanceCodes)
+        return false;
+
+    short lengths[maxLiteralCodes + maxDistanceCodes] = {};
+    for (int index = 0; index < ncode; ++index)
+        lengths[order[index]] = short(bits(3));
+    Huffman lengthCodes;
+    if (m_error || !construct(&lengthCodes, lengths, 19))
+        return false;
+
+    for (int index = 0; index < nlen + ndist; ) {
+        int symbol = decode(lengthCodes);
+        if (symbol < 0)
+            return false;
+        if (symbol < 16) {
+            lengths[index++] = short(symbol);
+            continue;
+        }
+        short length = 0;
+        int repeat = 0;
+        if (symbol == 16) {     // Repeat the previous length 3..6 times
+            if (index == 0)
+                return false;
+            length = lengths[index - 1];
+            repeat = 3 + bits(2);
+        } else if (symbol == 17) {
+            repeat = 3 + bits(3);
+        } else {
+            repeat = 11 + bits(7);
+        }
+        if (m_error || index + repeat > nlen + ndist)
+            return false;
+        while (repeat-- > 0)
+            lengths[index++] = length;
+    }
+    if (lengths[256] == 0)  // The end-of-block code is required
+        return false;
+
+    Huffman literals;
+    Huffman distances;
+    return construct(&literals, lengths, nlen)
+        && construct(&distances, lengths + nlen, ndist)
+        && codes(literals, distances);
+}
+
+bool Inflater::run()
+{
+    // zlib header: deflate method, no preset dictionary, valid check bits
+    if (m_size < 6)
+        return false;
+    const unsigned cmf = m_data[0];
+    const unsigned flg = m_data[1];
+    if ((cmf & 0x0f) != 8 || (flg & 0x20) != 0 || ((cmf << 8) | flg) % 31 != 0)
+        return false;
+    m_pos = 2;
+    m_size -= 4;    // Adler-32 checksum trailer
+
+    bool last = false;
+    while (!last) {
+        last = bits(1) != 0;
+        const int type = bits(2);
+        if (m_error)
+            return false;
+        bool ok = false;
+        switch (type) {
+        case 0:
+            ok = stored();
+            break;
+        case 1:
+            ok = fixed();
+            break;
+        case 2:
+            ok = dynamic();
+            break;
+        default:
+            break;
+        }
+        if (!ok || m_error)
+            return false;
+    }
+
+    const uint8_t *trailer = m_data + m_size;
+    const uint32_t expected = (uint32_t(trailer[0]) << 24) | (uint32_t(trailer[1]) << 16)
+                              | (uint32_t(trailer[2]) << 8) | uint32_t(trailer[3]);
+    uint32_t a = 1;
+    uint32_t b = 0;
+    for (char c : m_result) {
+        a = (a + uint8_t(c)) % 65521u;
+        b = (b + a) % 65521u;
+    }
+    return ((b << 16) | a) == expected;
+}
+
+} // namespace
+
+extern "C" {
+
+char *inflate_signature_bytes(const uint8_t *data, size_t size, size_t *resultSize)
+{
+    Inflater inflater(data, size);
+    if (!inflater.run())
+        return nullptr;
+    const auto &result = inflater.result();
+    auto *buffer = new char[result.size() + 1];
+    if (!result.empty())
+        std::memcpy(buffer, result.data(), result.size());
+    buffer[result.size()] = '\0';
+    *resultSize = result.size();
+    return buffer;
+}
+
+} // extern "C"
@@ -21,6 +21,7 @@ struct safe_globals_struc {
     PyObject *pyside_type_init_func;
     PyObject *create_signature_func;
     PyObject *seterror_argument_func;
+    PyObject *argument_error_type_func;
     PyObject *make_helptext_func;
     PyObject *finish_import_func;
     PyObject *feature_import_func;
@@ -66,6 +67,10 @@ PyObject *_address_to_stringlist(PyObject *numkey);
 int _build_func_to_type(PyObject *obtype);
 int _finish_nested_classes(PyObject *dict);
 
+// signature_inflate.cpp
+
+char *inflate_signature_bytes(const uint8_t *data, size_t size, size_t *resultSize);
+
 #ifdef PYPY_VERSION
 // PyPy has a special builtin method.
 PyObject *GetSignature_Method(PyObject *, PyObject *);
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "threadstatesaver.h"
+#include "gilstate.h"
 
 namespace Shiboken
 {
@@ -22,7 +23,7 @@ void ThreadStateSaver::save()
 void ThreadStateSaver::restore()
 {
     if (m_threadState) {
-        PyEval_RestoreThread(m_threadState);
+        GilState::restoreThread(m_threadState);
         m_threadState = nullptr;
     }
 }
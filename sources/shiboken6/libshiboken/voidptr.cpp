@@ -17,6 +17,7 @@ struct SbkVoidPtrObject {
     void *cptr;
     Py_ssize_t size;
     bool isWritable;
+    PyObject *owner; // Keeps the memory alive, may be nullptr
 };
 
 PyObject *SbkVoidPtrObject_new(PyTypeObject *type, PyObject * /* args */, PyObject * /* kwds */)
@@ -32,6 +33,7 @@ PyObject *SbkVoidPtrObject_new(PyTypeObject *type, PyObject * /* args */, PyObje
         self->cptr = nullptr;
         self->size = -1;
         self->isWritable = false;
+        self->owner = nullptr;
     }
 
     return reinterpret_cast<PyObject *>(self);
@@ -59,6 +61,9 @@ int SbkVoidPtrObject_init(PyObject *self, PyObject *args, PyObject *kwds)
         sbkSelf->cptr = sbkOther->cptr;
         sbkSelf->size = sbkOther->size;
         sbkSelf->isWritable = sbkOther->isWritable;
+        Py_XINCREF(sbkOther->owner);
+        Py_XDECREF(sbkSelf->owner);
+        sbkSelf->owner = sbkOther->owner;
     }
     // Python buffer interface.
     else if (PyObject_CheckBuffer(addressObject)) {
@@ -256,6 +261,13 @@ static PyBufferProcs SbkVoidPtrObjectBufferProc = {
     (releasebufferproc)nullptr                         // bf_releasebuffer
 };
 
+static void SbkVoidPtrObject_dealloc(PyObject *self)
+{
+    auto *sbkObject = reinterpret_cast<SbkVoidPtrObject *>(self);
+    Py_XDECREF(sbkObject->owner);
+    Sbk_object_dealloc(self);
+}
+
 static PyTypeObject *createVoidPtrType()
 {
     PyType_Slot SbkVoidPtrType_slots[] = {
@@ -266,7 +278,7 @@ static PyTypeObject *createVoidPtrType()
         {Py_tp_richcompare, reinterpret_cast<void *>(SbkVoidPtrObject_richcmp)},
         {Py_tp_init, reinterpret_cast<void *>(SbkVoidPtrObject_init)},
         {Py_tp_new, reinterpret_cast<void *>(SbkVoidPtrObject_new)},
-        {Py_tp_dealloc, reinterpret_cast<void *>(Sbk_object_dealloc)},
+        {Py_tp_dealloc, reinterpret_cast<void *>(SbkVoidPtrObject_dealloc)},
         {Py_tp_methods, reinterpret_cast<void *>(SbkVoidPtrObject_methods)},
         {0, nullptr}
     };
@@ -325,6 +337,22 @@ static PyObject *createVoidPtr(void *cppIn, Py_ssize_t size = 0, bool isWritable
     result->cptr = cppIn;
     result->size = size;
     result->isWritable = isWritable;
+    result->owner = nullptr;
+
+    return reinterpret_cast<PyObject *>(result);
+}
+
+PyObject *createWithOwner(void *cppIn, Py_ssize_t size, bool isWritable, PyObject *owner)
+{
+    SbkVoidPtrObject *result = PyObject_New(SbkVoidPtrObject, SbkVoidPtr_TypeF());
+    if (!result)
+        return nullptr;
+
+    result->cptr = cppIn;
+    result->size = size;
+    result->isWritable = isWritable;
+    Py_XINCREF(owner);
+    result->owner = owner;
 
     return reinterpret_cast<PyObject *>(result);
 }
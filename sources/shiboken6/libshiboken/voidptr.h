@@ -21,6 +21,8 @@ namespace VoidPtr
 
 void init();
 SbkConverter *createConverter();
+/// Creates a VoidPtr referencing \p owner, which keeps the memory alive.
+PyObject *createWithOwner(void *cppIn, Py_ssize_t size, bool isWritable, PyObject *owner);
 LIBSHIBOKEN_API void addVoidPtrToModule(PyObject *module);
 
 LIBSHIBOKEN_API void setSize(PyObject *voidPtr, Py_ssize_t size);
@@ -66,6 +66,24 @@ def matched_type(args, sigs):
     return None
 
 
+def argument_error_type(args, func_name):
+    """Returns the exception type of seterror_argument() for wrong arguments
+    without extra info, without formatting the message. Returns None when
+    the function name cannot be evaluated."""
+    try:
+        func = eval(func_name, namespace)
+    except Exception:
+        return None
+    sigs = get_signature(func, "typeerror")
+    if not sigs:
+        return TypeError
+    if type(sigs) != list:
+        sigs = [sigs]
+    if type(args) != tuple:
+        args = (args,)
+    return ValueError if matched_type(args, sigs) else TypeError
+
+
 def seterror_argument(args, func_name, info):
     func = None
     try:
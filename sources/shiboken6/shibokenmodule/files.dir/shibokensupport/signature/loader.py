@@ -45,6 +45,11 @@ def seterror_argument(args, func_name, info):
     return errorhandler.seterror_argument(args, func_name, info)
 
 
+# name used in signature.cpp
+def argument_error_type(args, func_name):
+    return errorhandler.argument_error_type(args, func_name)
+
+
 # name used in signature.cpp
 def make_helptext(func):
     return errorhandler.make_helptext(func)
@@ -0,0 +1,52 @@
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: BSD-3-Clause
+
+# Runs the generator for a test binding with --jobs=1 and --jobs=4 and checks
+# that the generated files are identical (the log files are not compared).
+# Parameters: SHIBOKEN, TOOL_WRAPPER, PROJECT_FILE, GENERATOR_FLAGS,
+# WORKING_DIRECTORY, OUTPUT_DIRECTORY
+
+set(job_counts 1 4)
+
+foreach(jobs ${job_counts})
+    set(output_dir "${OUTPUT_DIRECTORY}/jobs${jobs}")
+    file(REMOVE_RECURSE "${output_dir}")
+    file(MAKE_DIRECTORY "${output_dir}")
+    execute_process(
+        COMMAND ${TOOL_WRAPPER} "${SHIBOKEN}"
+                "--project-file=${PROJECT_FILE}"
+                ${GENERATOR_FLAGS}
+                "--output-directory=${output_dir}"
+                "--jobs=${jobs}"
+        WORKING_DIRECTORY "${WORKING_DIRECTORY}"
+        RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Running the generator with --jobs=${jobs} failed: ${result}")
+    endif()
+    file(GLOB_RECURSE files_${jobs} LIST_DIRECTORIES false
+         RELATIVE "${output_dir}" "${output_dir}/*")
+    list(FILTER files_${jobs} EXCLUDE REGEX "\\.log$")
+    list(SORT files_${jobs})
+endforeach()
+
+if(NOT files_1)
+    message(FATAL_ERROR "No files were generated in ${OUTPUT_DIRECTORY}/jobs1.")
+endif()
+if(NOT files_1 STREQUAL files_4)
+    message(FATAL_ERROR "Different files were generated:\n${files_1}\n${files_4}")
+endif()
+
+set(differing_files "")
+foreach(file ${files_1})
+    execute_process(
+        COMMAND "${CMAKE_COMMAND}" -E compare_files
+                "${OUTPUT_DIRECTORY}/jobs1/${file}" "${OUTPUT_DIRECTORY}/jobs4/${file}"
+        RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        list(APPEND differing_files "${file}")
+    endif()
+endforeach()
+
+if(differing_files)
+    message(FATAL_ERROR "Files differ between --jobs=1 and --jobs=4: ${differing_files}")
+endif()
@@ -62,6 +62,16 @@ void Overload::singleOverload(Point *)
 {
 }
 
+Overload::FunctionEnum Overload::wrapperOnlyOverloads(ObjectType *)
+{
+    return Function0;
+}
+
+Overload::FunctionEnum Overload::wrapperOnlyOverloads(const Echo &)
+{
+    return Function1;
+}
+
 Overload::FunctionEnum Overload::wrapperIntIntOverloads(const Polygon &, int, int)
 {
     return Function1;
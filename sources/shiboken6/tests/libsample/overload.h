@@ -92,6 +92,10 @@ public:
     FunctionEnum drawText4(int a0, int a1, int a2);
     FunctionEnum drawText4(int a0, int a1, int a2, int a3, int a4);
 
+    // Overloads taking only wrapper types without implicit conversions
+    FunctionEnum wrapperOnlyOverloads(ObjectType *object);
+    FunctionEnum wrapperOnlyOverloads(const Echo &echo);
+
     FunctionEnum acceptSequence();
     FunctionEnum acceptSequence(int a0, int a1);
     FunctionEnum acceptSequence(const Str &a0, ParamEnum a1 = Param0);
@@ -8,6 +8,9 @@
 #include <QtCore/QBuffer>
 #include <QtCore/QDebug>
 #include <QtCore/QLoggingCategory>
+#include <QtCore/QThreadPool>
+
+#include <atomic>
 
 using namespace Qt::StringLiterals;
 
@@ -514,4 +517,37 @@ void QtXmlToSphinxTest::testSnippetExtraction()
     QCOMPARE(actual, expected);
 }
 
+// Documentation is generated in parallel (option "jobs"). Check that
+// concurrent conversions produce the same output as serial ones.
+void QtXmlToSphinxTest::testConcurrentConversion()
+{
+    QStringList documents;
+    QStringList expected;
+    for (int i = 0; i < 8; ++i) {
+        const QString xml = "<heading level=\""_L1 + QString::number(i % 2)
+            + "\">Section "_L1 + QString(i + 1, u'x')
+            + "</heading><list type=\""_L1 + (i % 3 == 0 ? "ordered"_L1 : "bullet"_L1)
+            + "\"><item><para>Item 1</para></item><item><para>Item 2</para></item></list>"_L1;
+        documents.append(xml);
+        expected.append(transformXml(xml));
+    }
+
+    constexpr int threadCount = 4;
+    constexpr int iterations = 50;
+    std::atomic<int> mismatches{0};
+    QThreadPool pool;
+    pool.setMaxThreadCount(threadCount);
+    for (int t = 0; t < threadCount; ++t) {
+        pool.start([&, t]() {
+            for (int i = 0; i < iterations; ++i) {
+                const auto d = (t + i) % documents.size();
+                if (transformXml(documents.at(d)) != expected.at(d))
+                    ++mismatches;
+            }
+        });
+    }
+    pool.waitForDone();
+    QCOMPARE(mismatches.load(), 0);
+}
+
 QTEST_APPLESS_MAIN( QtXmlToSphinxTest)
@@ -30,6 +30,7 @@ private slots:
     void testTableFormattingIoDevice();
     void testSnippetExtraction_data();
     void testSnippetExtraction();
+    void testConcurrentConversion();
 
 private:
     QString transformXml(const QString &xml) const;
@@ -0,0 +1,88 @@
+#!/usr/bin/env python
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+'''Test cases for the generated registration of converter names.'''
+
+import os
+import re
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import get_build_dir
+
+
+REGISTER_NAMES_PATTERN = re.compile(
+    r'Shiboken::Conversions::registerConverterNames\(([^,]+),\s*(\{.*?\}\})\s*(?:,\s*(\{.*?\}\}))?\);',
+    re.DOTALL)
+EMPTY_NAMES_PATTERN = re.compile(
+    r'Shiboken::Conversions::registerConverterNames\(([^,]+),\s*\{\},\s*(\{.*?\}\})\);',
+    re.DOTALL)
+NAME_PATTERN = re.compile(r'\{0x([0-9a-f]+)ULL, "([^"]+)"\}')
+
+
+def converter_name_hash(name):
+    '''64bit FNV-1a as implemented by Shiboken::Conversions::converterNameHash().'''
+    result = 14695981039346656037
+    for c in name.encode('utf-8'):
+        result ^= c
+        result = (result * 1099511628211) % 2**64
+    return result
+
+
+def parse_names(names):
+    return [(int(h, 16), name) for h, name in NAME_PATTERN.findall(names)]
+
+
+class ConverterNamesTest(unittest.TestCase):
+    '''Checks the code registering the names of the converters of the sample module.'''
+
+    @classmethod
+    def setUpClass(cls):
+        cls.generated_dir = (Path(get_build_dir()) / 'shiboken6' / 'tests' / 'samplebinding'
+                             / 'sample')
+        if not cls.generated_dir.is_dir():
+            raise unittest.SkipTest(f'{cls.generated_dir} not found')
+
+    def read(self, file_name):
+        return (self.generated_dir / file_name).read_text(encoding='utf-8')
+
+    def assertHashes(self, names):
+        self.assertTrue(names)
+        for hash_value, name in names:
+            self.assertEqual(hash_value, converter_name_hash(name), name)
+
+    def testClassNames(self):
+        '''The names of a class are registered in one call with their hashes.'''
+        match = REGISTER_NAMES_PATTERN.search(self.read('point_wrapper.cpp'))
+        self.assertTrue(match)
+        names = parse_names(match.group(2))
+        self.assertEqual([name for _h, name in names], ['Point', 'Point*', 'Point&'])
+        self.assertHashes(names)
+        self.assertIsNone(match.group(3))  # No aliases
+
+    def testAliasesOnly(self):
+        '''A primitive type referencing another type only registers aliases.'''
+        code = self.read('sample_module_wrapper.cpp')
+        aliases = []
+        for match in EMPTY_NAMES_PATTERN.finditer(code):
+            aliases.extend(parse_names(match.group(2)))
+        names = [name for _h, name in aliases]
+        self.assertIn('Foo::SAMPLE_HANDLE', names)
+        self.assertIn('SAMPLE_HANDLE', names)
+        self.assertHashes(aliases)
+
+    def testReserve(self):
+        '''The module initialization reserves the names before registering them.'''
+        code = self.read('sample_module_wrapper.cpp')
+        match = re.search(r'Shiboken::Conversions::reserveConverterNames\((\d+)\);', code)
+        self.assertTrue(match)
+        self.assertGreater(int(match.group(1)), 0)
+        self.assertLess(match.start(), code.index('// Register primitive types converters.'))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,116 @@
+#!/usr/bin/env python
+# Copyright (C) 2024 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+from __future__ import annotations
+
+'''Stress test for the concurrent use of a binding from several threads.
+
+In a free-threaded build of Python (3.13t), the threads run in parallel and
+exercise the synchronization of the tables shared by libshiboken (wrappers,
+override name caches, converters, types). With the GIL, they interleave.'''
+
+import os
+import sys
+import sysconfig
+import threading
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+
+from sample import Event, ObjectType, Point, VirtualMethods
+
+
+THREAD_COUNT = 8
+ITERATIONS = 300
+
+
+class Receiver(ObjectType):
+
+    def __init__(self, parent=None):
+        super().__init__(parent)
+        self.received = 0
+
+    def event(self, event):
+        self.received += 1
+        return event.eventType() == Event.BASIC_EVENT
+
+
+class NegatingVirtualMethods(VirtualMethods):
+
+    def virtualMethod0(self, pt, val, cpx, b):
+        return -VirtualMethods.virtualMethod0(self, pt, val, cpx, b)
+
+
+class FreeThreadingTest(unittest.TestCase):
+
+    def runThreads(self, worker):
+        barrier = threading.Barrier(THREAD_COUNT)
+        errors = []
+
+        def run(index):
+            barrier.wait()
+            try:
+                worker(index)
+            except Exception as e:  # noqa: B902
+                errors.append(e)
+
+        threads = [threading.Thread(target=run, args=(i,)) for i in range(THREAD_COUNT)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        self.assertEqual(errors, [])
+
+    @unittest.skipUnless(sysconfig.get_config_var("Py_GIL_DISABLED"), "Requires free-threading")
+    def testGilNotEnabled(self):
+        '''The sample binding is generated with --gil-not-used, importing it
+        must not re-enable the GIL.'''
+        self.assertFalse(sys._is_gil_enabled())
+
+    def testVirtualOverrides(self):
+        '''Overrides called from C++ share the name caches of the wrappers.'''
+        def worker(index):
+            for i in range(ITERATIONS):
+                base = VirtualMethods()
+                derived = NegatingVirtualMethods()
+                pt = Point(index, i)
+                expected = base.callVirtualMethod0(pt, i, complex(1, 2), True)
+                self.assertEqual(derived.callVirtualMethod0(pt, i, complex(1, 2), True),
+                                 -expected)
+
+        self.runThreads(worker)
+
+    def testWrapperLifetime(self):
+        '''Wrappers of parents and children are created and destroyed concurrently.'''
+        def worker(index):
+            for i in range(ITERATIONS):
+                parent = Receiver()
+                children = [Receiver(parent) for _ in range(4)]
+                self.assertEqual(len(parent.children()), 4)
+                self.assertEqual(children[-1].parent(), parent)
+                objects = [parent] + children
+                self.assertEqual(ObjectType.processEvent(objects, Event(Event.BASIC_EVENT)),
+                                 len(objects))
+                self.assertTrue(all(o.received == 1 for o in objects))
+                del children
+                del parent
+
+        self.runThreads(worker)
+
+    def testValueConversions(self):
+        '''Value types and containers are converted concurrently.'''
+        def worker(index):
+            total = Point(0, 0)
+            for i in range(ITERATIONS):
+                total += Point(index, 1)
+                self.assertEqual(total, Point(index * (i + 1), i + 1))
+                self.assertEqual(Point(index, i) + Point(1, 1), Point(index + 1, i + 1))
+
+        self.runThreads(worker)
+
+
+if __name__ == '__main__':
+    unittest.main()
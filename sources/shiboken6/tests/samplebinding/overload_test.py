@@ -6,6 +6,7 @@ from __future__ import annotations
 '''Test cases for Overload class'''
 
 import os
+import pickle
 import sys
 import unittest
 
@@ -13,7 +14,10 @@ from pathlib import Path
 sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
 from shiboken_paths import init_paths
 init_paths()
-from sample import Echo, Overload, Point, PointF, Polygon, Rect, RectF, Size, Str
+from sample import (Echo, ObjectType, ObjectTypeDerived, Overload, Point, PointF, Polygon,
+                    Rect, RectF, Size, Str)
+
+from shibokensupport.signature import errorhandler
 
 
 def raisesWithErrorMessage(func, arguments, errorType, errorMsg):
@@ -80,6 +84,25 @@ class OverloadTest(unittest.TestCase):
         self.assertEqual(overload.wrapperIntIntOverloads(Point(), 1, 2), Overload.Function0)
         self.assertEqual(overload.wrapperIntIntOverloads(Polygon(), 1, 2), Overload.Function1)
 
+    def testWrapperOnlyOverloads(self):
+        '''Check the exact type lookup of overloads taking only wrapper types.'''
+
+        class PyObjectType(ObjectType):
+            pass
+
+        class PyEcho(Echo):
+            pass
+
+        overload = Overload()
+        self.assertEqual(overload.wrapperOnlyOverloads(ObjectType()), Overload.Function0)
+        self.assertEqual(overload.wrapperOnlyOverloads(ObjectTypeDerived()), Overload.Function0)
+        self.assertEqual(overload.wrapperOnlyOverloads(PyObjectType()), Overload.Function0)
+        self.assertEqual(overload.wrapperOnlyOverloads(None), Overload.Function0)
+        self.assertEqual(overload.wrapperOnlyOverloads(Echo()), Overload.Function1)
+        self.assertEqual(overload.wrapperOnlyOverloads(PyEcho()), Overload.Function1)
+        self.assertRaises(TypeError, overload.wrapperOnlyOverloads, Point())
+        self.assertRaises(TypeError, overload.wrapperOnlyOverloads, 1)
+
     def testDrawTextPointAndStr(self):
         overload = Overload()
         self.assertEqual(overload.drawText(Point(), Str()), Overload.Function0)
@@ -137,6 +160,36 @@ class OverloadTest(unittest.TestCase):
                                         TypeError, 'called with wrong argument types:')
         self.assertTrue(result)
 
+    def testWrongArgumentsErrorIsFormattedOnDemand(self):
+        overload = Overload()
+        for _ in range(100):
+            with self.assertRaises(TypeError):
+                overload.drawText3(Str(), Str(), Str(), 4, 5)
+        with self.assertRaises(TypeError) as cm:
+            overload.drawText3(Str(), Str(), Str(), 4, 5)
+        self.assertTrue('called with wrong argument types:' in cm.exception.args[0])
+        self.assertEqual(str(cm.exception), cm.exception.args[0])
+        copy = pickle.loads(pickle.dumps(cm.exception))
+        self.assertEqual(type(copy), TypeError)
+        self.assertEqual(copy.args, cm.exception.args)
+
+    def testWrongArgumentValuesErrorIsValueError(self):
+        # Pretend the argument types match a signature, for which the error
+        # handler reports a ValueError. The lazy error must keep that type.
+        matched_type = errorhandler.matched_type
+        errorhandler.matched_type = lambda args, sigs: sigs[0]
+        try:
+            overload = Overload()
+            with self.assertRaises(ValueError) as cm:
+                overload.drawText3(Str(), Str(), Str(), 4, 5)
+            # The message is formatted on demand, while the handler is patched.
+            self.assertTrue('called with wrong argument values:' in str(cm.exception))
+        finally:
+            errorhandler.matched_type = matched_type
+        self.assertNotIsInstance(cm.exception, TypeError)
+        copy = pickle.loads(pickle.dumps(cm.exception))
+        self.assertEqual(type(copy), ValueError)
+
     def testDrawText4(self):
         overload = Overload()
         self.assertEqual(overload.drawText4(1, 2, 3), Overload.Function0)